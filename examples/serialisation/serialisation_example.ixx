@@ -1,7 +1,11 @@
 export module SerialisationExample;
 import "neat/Reflection.h";
+import "neat/Conversion.h";
+import "neat/ContainerView.h";
+import "neat/DispatchTable.h";
 import "nlohmann/json.hpp";
 import <string>;
+import <cstdint>;
 import <vector>;
 import <iostream>;
 import <cassert>;
@@ -32,26 +36,33 @@ using json = nlohmann::json;
 
 json serialise(Neat::AnyPtr object)
 {
-    if (object.type_id == Neat::get_id<int>())
-    {
-        return *static_cast<int*>(object.value_ptr);
-    }
-    else if (object.type_id == Neat::get_id<float>())
-    {
-        return *static_cast<float*>(object.value_ptr);
-    }
-    else if (object.type_id == Neat::get_id<double>())
-    {
-        return *static_cast<double*>(object.value_ptr);
-    }
-    else if (object.type_id == Neat::get_id<std::string>())
-    {
-        return *static_cast<std::string*>(object.value_ptr);
-    }
-    else
-    {
-        return json{};
-    }
+    // Built once, each call is a single table lookup instead of comparing the type id with every handled type.
+    static const auto serialisers = [] {
+        auto table = Neat::DispatchTable<json()>::create(
+            [](const int& value) -> json { return value; },
+            [](const float& value) -> json { return value; },
+            [](const double& value) -> json { return value; },
+            [](const std::string& value) -> json { return value; }
+        );
+        table.set_default([](Neat::AnyPtr object) {
+            // Containers like `std::vector<int>` are serialised element by element
+            const auto sequence = Neat::SequenceView::create(object);
+            if (!sequence)
+            {
+                return json{};
+            }
+
+            json elements = json::array();
+            for (size_t i = 0; i < sequence.size(); ++i)
+            {
+                elements.push_back(serialise(sequence[i].to_any_ptr()));
+            }
+            return elements;
+        });
+        return table;
+    }();
+
+    return Neat::visit(object, serialisers);
 }
 
 void deserialise(Neat::AnyPtr object, const Neat::Field& field, const json& data)
@@ -61,25 +72,22 @@ void deserialise(Neat::AnyPtr object, const Neat::Field& field, const json& data
         return;
     }
 
+    // Read the json value as the closest type, then let the conversion table turn it into the field's type.
     Neat::Any value{};
 
-    if (field.type == Neat::get_id<int>()) 
-    {
-        value = data.get<int>();
-    }
-    else if (field.type == Neat::get_id<bool>())
+    if (data.is_boolean())
     {
         value = data.get<bool>();
     }
-    else if (field.type == Neat::get_id<float>())
+    else if (data.is_number_integer())
     {
-        value = data.get<float>();
+        value = data.get<int64_t>();
     }
-    else if (field.type == Neat::get_id<double>()) 
+    else if (data.is_number_float())
     {
         value = data.get<double>();
     }
-    else if (field.type == Neat::get_id<std::string>()) 
+    else if (data.is_string())
     {
         value = data.get<std::string>();
     }
@@ -98,6 +106,12 @@ void deserialise(Neat::AnyPtr object, const Neat::Field& field, const json& data
     //    return obj;
     //}
 
+    value = Neat::convert(value, field.type);
+    if (!value.has_value())
+    {
+        return;
+    }
+
     field.set_value(object, value);
 }
 
@@ -4,9 +4,12 @@
 #pragma once
 #include "neat/Defines.h"
 #include "neat/TemplateTypeId.h"
+#include "neat/ValueOperations.h"
 
 #include <cassert>
+#include <compare>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 
@@ -14,6 +17,8 @@
 namespace Neat
 {
 	struct AnyPtr;
+	struct AnyRef;
+	struct AnyConstRef;
 	class Any;
 }
 
@@ -33,6 +38,66 @@ namespace Neat
 	template<typename T>
 	concept NotAny = !std::is_same_v<std::decay_t<T>, Any>;
 
+	template<typename T>
+	concept NotAnyWrapper = NotAny<T>
+		&& !std::is_same_v<std::decay_t<T>, AnyPtr>
+		&& !std::is_same_v<std::decay_t<T>, AnyRef>
+		&& !std::is_same_v<std::decay_t<T>, AnyConstRef>;
+
+	// Non owning reference to a value, like AnyPtr but with typed accessors.
+	// Never copies the value it refers to.
+	struct AnyRef
+	{
+		// Construction
+		AnyRef() = default;
+		AnyRef(void* value_ptr, TemplateTypeId type_id);
+		AnyRef(AnyPtr any_ptr);
+		template<NotAnyWrapper T> requires (!std::is_const_v<T>)
+		AnyRef(T& value); // Const values only convert to `AnyConstRef`
+
+		// Accessors
+		bool has_value() const;
+		template<typename T>
+		T& get() const;
+		template<typename T>
+		T* try_get() const;
+
+		// Conversion
+		AnyPtr to_any_ptr() const;
+
+		// Data
+		void* value_ptr = nullptr;
+		TemplateTypeId type_id = c_empty_type_id;
+
+		// Operators
+		auto operator<=>(const AnyRef& other) const noexcept = default;
+	};
+
+	// Non owning reference to a const value.
+	struct AnyConstRef
+	{
+		// Construction
+		AnyConstRef() = default;
+		AnyConstRef(const void* value_ptr, TemplateTypeId type_id);
+		AnyConstRef(AnyRef any_ref);
+		template<NotAnyWrapper T>
+		AnyConstRef(const T& value);
+
+		// Accessors
+		bool has_value() const;
+		template<typename T>
+		const T& get() const;
+		template<typename T>
+		const T* try_get() const;
+
+		// Data
+		const void* value_ptr = nullptr;
+		TemplateTypeId type_id = c_empty_type_id;
+
+		// Operators
+		auto operator<=>(const AnyConstRef& other) const noexcept = default;
+	};
+
 	class Any
 	{
 	public:
@@ -58,10 +123,20 @@ namespace Neat
 
 		// Conversion
 		REFL_API AnyPtr to_any_ptr();
+		REFL_API AnyRef to_any_ref();
+		REFL_API AnyConstRef to_any_ref() const;
+
+		// Comparison & hashing
+		// Values of different types are ordered by their type id.
+		// Values of types without an operator== are only equal to themselves, or to copies sharing the same boxed storage.
+		REFL_API bool operator==(const Any& other) const;
+		REFL_API std::partial_ordering operator<=>(const Any& other) const;
+		REFL_API size_t hash() const;
 
 	private:
 		// Helpers
 		REFL_API void* object_pointer();
+		REFL_API const void* object_pointer() const;
 
 		// Private data types
 		enum class StorageMode : uint8_t { Empty, InlineValue, BoxedValue };
@@ -78,6 +153,7 @@ namespace Neat
 
 		// Data
 		Storage storage;
+		const ValueOperations* value_operations = nullptr;
 		TemplateTypeId template_type_id = c_empty_type_id;
 		StorageMode storage_mode = StorageMode::Empty;
 	};
@@ -87,12 +163,102 @@ namespace Neat
 // Implementation
 namespace Neat
 {
+	inline AnyRef::AnyRef(void* value_ptr, TemplateTypeId type_id)
+		: value_ptr(value_ptr)
+		, type_id(type_id)
+	{
+	}
+
+	inline AnyRef::AnyRef(AnyPtr any_ptr)
+		: value_ptr(any_ptr.value_ptr)
+		, type_id(any_ptr.type_id)
+	{
+	}
+
+	template<NotAnyWrapper T> requires (!std::is_const_v<T>)
+	AnyRef::AnyRef(T& value)
+		: value_ptr(&value)
+		, type_id(get_id<T>())
+	{
+	}
+
+	inline bool AnyRef::has_value() const
+	{
+		return value_ptr != nullptr;
+	}
+
+	template<typename T>
+	T& AnyRef::get() const
+	{
+		assert(has_value());
+		assert(get_id<std::remove_cv_t<T>>() == type_id);
+		return *static_cast<T*>(value_ptr);
+	}
+
+	template<typename T>
+	T* AnyRef::try_get() const
+	{
+		if (get_id<std::remove_cv_t<T>>() != type_id) {
+			return nullptr;
+		}
+
+		return static_cast<T*>(value_ptr);
+	}
+
+	inline AnyPtr AnyRef::to_any_ptr() const
+	{
+		return AnyPtr{ value_ptr, type_id };
+	}
+
+	inline AnyConstRef::AnyConstRef(const void* value_ptr, TemplateTypeId type_id)
+		: value_ptr(value_ptr)
+		, type_id(type_id)
+	{
+	}
+
+	inline AnyConstRef::AnyConstRef(AnyRef any_ref)
+		: value_ptr(any_ref.value_ptr)
+		, type_id(any_ref.type_id)
+	{
+	}
+
+	template<NotAnyWrapper T>
+	AnyConstRef::AnyConstRef(const T& value)
+		: value_ptr(&value)
+		, type_id(get_id<T>())
+	{
+	}
+
+	inline bool AnyConstRef::has_value() const
+	{
+		return value_ptr != nullptr;
+	}
+
+	template<typename T>
+	const T& AnyConstRef::get() const
+	{
+		assert(has_value());
+		assert(get_id<std::remove_cv_t<T>>() == type_id);
+		return *static_cast<const T*>(value_ptr);
+	}
+
+	template<typename T>
+	const T* AnyConstRef::try_get() const
+	{
+		if (get_id<std::remove_cv_t<T>>() != type_id) {
+			return nullptr;
+		}
+
+		return static_cast<const T*>(value_ptr);
+	}
+
 	template<NotAny T>
 	Any::Any(T&& value)
 	{
 		using CleanT = std::remove_cvref_t<T>;
 
 		template_type_id = get_id<CleanT>();
+		value_operations = &value_operations_v<CleanT>;
 
 		if (sizeof(CleanT) <= Storage::c_inline_storage_size && alignof(CleanT) <= alignof(Storage) && std::is_trivial_v<CleanT>) {
 			new (storage.inline_value) CleanT{ value };
@@ -133,3 +299,15 @@ namespace Neat
 		return static_cast<T*>(object_pointer());
 	}
 }
+
+namespace std
+{
+	template<>
+	struct hash<Neat::Any>
+	{
+		size_t operator()(const Neat::Any& any) const
+		{
+			return any.hash();
+		}
+	};
+}
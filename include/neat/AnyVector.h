@@ -0,0 +1,151 @@
+// A contiguous container of values which all have the same runtime type.
+// Unlike `std::vector<Any>` the type id is stored once and the elements are laid out `Type::size` apart,
+// so iterating a reflected collection stays cache friendly.
+#pragma once
+#include "neat/Defines.h"
+#include "neat/TemplateTypeId.h"
+#include "neat/Any.h"
+#include "neat/Reflection.h"
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+
+namespace Neat
+{
+	class AnyVector
+	{
+	public:
+		// Construction & Deconstruction
+		AnyVector() = default;
+		REFL_API explicit AnyVector(TemplateTypeId type_id); // The type needs to be registered
+		REFL_API explicit AnyVector(const Type& type);
+		REFL_API AnyVector(const AnyVector& other);
+		REFL_API AnyVector(AnyVector&& other) noexcept;
+		REFL_API AnyVector& operator=(const AnyVector& other);
+		REFL_API AnyVector& operator=(AnyVector&& other) noexcept;
+		REFL_API ~AnyVector();
+
+		// Accessors
+		TemplateTypeId type_id() const { return element_type_id; }
+		size_t stride() const { return element_size; }
+		size_t size() const { return element_count; }
+		size_t capacity() const { return element_capacity; }
+		bool empty() const { return element_count == 0; }
+
+		void* data() { return buffer; }
+		const void* data() const { return buffer; }
+
+		AnyRef operator[](size_t index);
+		AnyConstRef operator[](size_t index) const;
+		AnyRef back();
+
+		template<typename T>
+		std::span<T> as_span();
+		template<typename T>
+		std::span<const T> as_span() const;
+
+		// Modifiers
+		REFL_API void reserve(size_t new_capacity);
+		REFL_API void resize(size_t new_size); // New elements are default constructed
+		REFL_API AnyRef emplace_back(); // Default constructs the new element
+		REFL_API void push_back(AnyConstRef value); // Copy constructs the new element
+		template<NotAnyWrapper T>
+		void push_back(T&& value);
+		REFL_API void pop_back();
+		REFL_API void clear();
+
+	private:
+		// Helpers
+		void* element_pointer(size_t index) const;
+		template<typename TConstruct>
+		void construct_at_end(TConstruct&& construct);
+		REFL_API std::byte* allocate_grown_buffer(size_t& new_capacity) const;
+		REFL_API void adopt_buffer(std::byte* new_buffer, size_t new_capacity); // Relocates the elements and frees the old buffer
+
+		// Data
+		std::byte* buffer = nullptr;
+		size_t element_count = 0;
+		size_t element_capacity = 0;
+
+		// Copied from the Type, the registry may move Type objects around when new types are added.
+		TemplateTypeId element_type_id = c_empty_type_id;
+		size_t element_size = 0;
+		size_t element_alignment = 1;
+		Type::ConstructNFunction construct_n = nullptr;
+		Type::DestroyNFunction destroy_n = nullptr;
+		Type::CopyNFunction copy_n = nullptr;
+		Type::RelocateFunction relocate_n = nullptr;
+	};
+}
+
+
+// Implementation
+namespace Neat
+{
+	inline void* AnyVector::element_pointer(size_t index) const
+	{
+		return buffer + index * element_size;
+	}
+
+	inline AnyRef AnyVector::operator[](size_t index)
+	{
+		assert(index < element_count);
+		return AnyRef{ element_pointer(index), element_type_id };
+	}
+
+	inline AnyConstRef AnyVector::operator[](size_t index) const
+	{
+		assert(index < element_count);
+		return AnyConstRef{ element_pointer(index), element_type_id };
+	}
+
+	inline AnyRef AnyVector::back()
+	{
+		assert(!empty());
+		return (*this)[element_count - 1];
+	}
+
+	template<typename T>
+	std::span<T> AnyVector::as_span()
+	{
+		assert(get_id<T>() == element_type_id);
+		return { reinterpret_cast<T*>(buffer), element_count };
+	}
+
+	template<typename T>
+	std::span<const T> AnyVector::as_span() const
+	{
+		assert(get_id<T>() == element_type_id);
+		return { reinterpret_cast<const T*>(buffer), element_count };
+	}
+
+	template<typename TConstruct>
+	void AnyVector::construct_at_end(TConstruct&& construct)
+	{
+		if (element_count < element_capacity) {
+			construct(element_pointer(element_count));
+			++element_count;
+			return;
+		}
+
+		// Construct the new element before the old buffer is freed, the value might be one of the elements, e.g. `push_back(v[0])`.
+		size_t new_capacity = 0;
+		std::byte* new_buffer = allocate_grown_buffer(new_capacity);
+		construct(new_buffer + element_count * element_size);
+		adopt_buffer(new_buffer, new_capacity);
+		++element_count;
+	}
+
+	template<NotAnyWrapper T>
+	void AnyVector::push_back(T&& value)
+	{
+		using CleanT = std::remove_cvref_t<T>;
+		assert(get_id<CleanT>() == element_type_id);
+
+		construct_at_end([&value](void* slot) { new (slot) CleanT(std::forward<T>(value)); });
+	}
+}
@@ -0,0 +1,113 @@
+// Opt-in recording of field writes, e.g. to replicate only the fields changed since the last tick without diffing.
+// Tracked objects get a dirty bit per field, indexed by `Field::index`. Writes through `Field::set_value` and `FieldHandle::set`
+// are recorded, `mark_dirty` records direct writes. While nothing is tracked a write only checks an inline counter.
+// Only the type's own fields are tracked. Writes to fields of a base class (through the base's `Field` and the upcast object)
+// aren't recorded, mark them with `mark_dirty` on the derived object if needed.
+// Objects are tracked by address, untrack them before they're destroyed. Like the registry, this isn't thread safe.
+#pragma once
+#include "neat/Defines.h"
+#include "neat/TemplateTypeId.h"
+#include "neat/Any.h"
+#include "neat/Reflection.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace Neat
+{
+	class DirtyFields
+	{
+	public:
+		// Accessors
+		bool test(size_t field_index) const;
+		bool any() const { return inline_bits != 0 || !overflow_bits.empty(); }
+		size_t count() const;
+
+		// Calls `function(size_t field_index)` for each dirty field, in field order.
+		template<typename TFunction>
+		void for_each(TFunction&& function) const;
+
+		// Modifiers
+		void set(size_t field_index);
+		void clear();
+
+	private:
+		// Data
+		static constexpr size_t c_bits_per_word = 64;
+		uint64_t inline_bits = 0; // The first 64 fields, most types don't have more
+		std::vector<uint64_t> overflow_bits;
+	};
+
+	REFL_API void track_changes(AnyPtr object); // Starts with no dirty fields, tracking an object twice keeps its dirty fields
+	REFL_API void untrack_changes(AnyPtr object);
+	REFL_API bool is_tracked(AnyPtr object);
+
+	// Does nothing when the object isn't tracked.
+	REFL_API void mark_dirty(AnyPtr object, size_t field_index);
+
+	// Returns the fields written since the last call and clears them, empty when the object isn't tracked.
+	REFL_API DirtyFields consume_dirty(AnyPtr object);
+}
+
+
+// Implementation
+namespace Neat
+{
+	inline bool DirtyFields::test(size_t field_index) const
+	{
+		if (field_index < c_bits_per_word) {
+			return (inline_bits >> field_index) & 1;
+		}
+
+		const size_t word = field_index / c_bits_per_word - 1;
+		return word < overflow_bits.size() && ((overflow_bits[word] >> (field_index % c_bits_per_word)) & 1);
+	}
+
+	inline size_t DirtyFields::count() const
+	{
+		size_t dirty_count = std::popcount(inline_bits);
+		for (uint64_t bits : overflow_bits) {
+			dirty_count += std::popcount(bits);
+		}
+		return dirty_count;
+	}
+
+	template<typename TFunction>
+	void DirtyFields::for_each(TFunction&& function) const
+	{
+		const auto visit_word = [&function](uint64_t bits, size_t first_index) {
+			while (bits != 0) {
+				function(first_index + std::countr_zero(bits));
+				bits &= bits - 1;
+			}
+		};
+
+		visit_word(inline_bits, 0);
+		for (size_t word = 0; word < overflow_bits.size(); ++word) {
+			visit_word(overflow_bits[word], (word + 1) * c_bits_per_word);
+		}
+	}
+
+	inline void DirtyFields::set(size_t field_index)
+	{
+		if (field_index < c_bits_per_word) {
+			inline_bits |= uint64_t{ 1 } << field_index;
+			return;
+		}
+
+		const size_t word = field_index / c_bits_per_word - 1;
+		if (word >= overflow_bits.size()) {
+			overflow_bits.resize(word + 1);
+		}
+		overflow_bits[word] |= uint64_t{ 1 } << (field_index % c_bits_per_word);
+	}
+
+	inline void DirtyFields::clear()
+	{
+		inline_bits = 0;
+		overflow_bits.clear();
+	}
+}
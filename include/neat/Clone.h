@@ -0,0 +1,58 @@
+// Deep copies of reflected objects, e.g. spawning entities from a prototype.
+// Each type is compiled once into a copy plan: trivially copyable types are copied with memcpy, copyable types use their
+// copy constructor and the reflected fields of other types are cloned one by one, with memcpy runs over trivially copyable fields.
+// Unlike the copy constructor, `std::unique_ptr` and non copyable `std::optional` members are cloned by cloning their pointee.
+// Raw pointers are copied as is, unless an arena is given, then the pointee is cloned into the arena. Each pointee is cloned
+// once per cloned object, pointers to the same pointee (or back to the object itself) point to the same clone.
+// Every reachable type needs to be registered. Like the registry, this isn't thread safe.
+#pragma once
+#include "neat/Defines.h"
+#include "neat/TemplateTypeId.h"
+#include "neat/Any.h"
+#include "neat/Reflection.h"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+
+namespace Neat
+{
+	// Owns the objects cloned behind raw pointers, destroys them in reverse order when it's reset or destroyed.
+	class CloneArena
+	{
+	public:
+		// Construction & Deconstruction
+		REFL_API explicit CloneArena(size_t block_size = 64 * 1024);
+		CloneArena(const CloneArena&) = delete;
+		CloneArena& operator=(const CloneArena&) = delete;
+		REFL_API ~CloneArena();
+
+		// Accessors
+		size_t bytes_allocated() const { return allocated_size; }
+
+		// Modifiers
+		REFL_API void* allocate(size_t size, size_t alignment);
+		REFL_API void add_destructor(AnyPtr object, Type::Destructor destructor); // Called when the arena is reset
+		REFL_API void reset();
+
+	private:
+		// Data
+		std::vector<std::unique_ptr<std::byte[]>> blocks;
+		std::vector<std::pair<AnyPtr, Type::Destructor>> destructors;
+		std::byte* block_position = nullptr;
+		size_t block_space = 0;
+		size_t block_size;
+		size_t allocated_size = 0;
+	};
+
+	// `uninitialised_destination` needs to point to uninitialised storage for an object of the source's type.
+	// Returns false when some value couldn't be cloned, it's left default constructed then. The destination is always constructed,
+	// unless the type can't be cloned at all (e.g. it isn't registered, or has a private base and no copy constructor),
+	// then nothing is constructed and false is returned.
+	REFL_API bool clone(AnyPtr source, AnyPtr uninitialised_destination, CloneArena* arena = nullptr);
+
+	// Clones the prototype into `count` contiguous objects.
+	REFL_API bool clone_n(AnyPtr prototype, AnyPtr uninitialised_destinations, size_t count, CloneArena* arena = nullptr);
+}
@@ -0,0 +1,255 @@
+// Type erased sequence and map operations, instantiated once per container type.
+// Recognises random access sequences (std::vector, std::array, std::deque, std::string, C arrays)
+// and maps (std::map, std::unordered_map). Used by `SequenceView` and `MapView`.
+#pragma once
+#include "neat/Defines.h"
+#include "neat/TemplateTypeId.h"
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+
+
+namespace Neat
+{
+	struct SequenceOperations
+	{
+		using SizeFunction = size_t (*)(const void* container);
+		using AtFunction = void* (*)(void* container, size_t index);
+		using DataFunction = void* (*)(void* container);
+		using ResizeFunction = void (*)(void* container, size_t size); // New elements are value initialised
+		using ReserveFunction = void (*)(void* container, size_t capacity);
+		using PushBackFunction = void (*)(void* container, const void* value); // Copies the value
+		using ClearFunction = void (*)(void* container);
+		using TypeIdFunction = TemplateTypeId (*)();
+
+		// Functions, nullptr when the container doesn't support the operation.
+		SizeFunction size = nullptr;
+		AtFunction at = nullptr;
+		DataFunction data = nullptr; // Only for contiguous containers
+		ResizeFunction resize = nullptr;
+		ReserveFunction reserve = nullptr;
+		PushBackFunction push_back = nullptr;
+		ClearFunction clear = nullptr;
+		TypeIdFunction element_type = nullptr;
+
+		// Data
+		size_t element_size = 0;
+		bool element_trivially_copyable = false;
+	};
+
+	struct MapOperations
+	{
+		using SizeFunction = size_t (*)(const void* container);
+		using FindFunction = void* (*)(void* container, const void* key); // Returns the mapped value, or nullptr
+		using InsertFunction = void* (*)(void* container, const void* key, const void* value); // Copies, overwrites existing values
+		using EraseFunction = bool (*)(void* container, const void* key);
+		using ReserveFunction = void (*)(void* container, size_t capacity);
+		using ClearFunction = void (*)(void* container);
+		using Visitor = void (*)(void* context, const void* key, void* value);
+		using ForEachFunction = void (*)(void* container, Visitor visitor, void* context);
+		using TypeIdFunction = TemplateTypeId (*)();
+
+		// Functions, nullptr when the container doesn't support the operation.
+		SizeFunction size = nullptr;
+		FindFunction find = nullptr;
+		InsertFunction insert = nullptr;
+		EraseFunction erase = nullptr;
+		ReserveFunction reserve = nullptr;
+		ClearFunction clear = nullptr;
+		ForEachFunction for_each = nullptr;
+		TypeIdFunction key_type = nullptr;
+		TypeIdFunction mapped_type = nullptr;
+	};
+
+	// Random access ranges which hand out references to their elements, `std::vector<bool>` is excluded.
+	template<typename T>
+	concept ReflectableSequence = std::ranges::random_access_range<T> && std::ranges::sized_range<T>
+		&& std::is_lvalue_reference_v<std::ranges::range_reference_t<T>>;
+
+	template<typename T>
+	concept ReflectableMap = std::ranges::forward_range<T>
+		&& requires { typename T::key_type; typename T::mapped_type; }
+		&& requires(T& map, const typename T::key_type& key) { map.find(key); map.erase(key); };
+
+	// nullptr when T isn't a recognised container
+	template<typename T>
+	constexpr const SequenceOperations* get_sequence_operations();
+	template<typename T>
+	constexpr const MapOperations* get_map_operations();
+}
+
+
+// Implementation
+namespace Neat
+{
+	namespace Detail
+	{
+		template<typename T>
+		using SequenceElement = std::ranges::range_value_t<T>;
+
+		template<typename T>
+		size_t sequence_size_erased(const void* container)
+		{
+			return static_cast<size_t>(std::ranges::size(*static_cast<const T*>(container)));
+		}
+
+		template<typename T>
+		void* sequence_at_erased(void* container, size_t index)
+		{
+			return std::addressof(std::ranges::begin(*static_cast<T*>(container))[index]);
+		}
+
+		template<typename T>
+		void* sequence_data_erased(void* container)
+		{
+			return std::ranges::data(*static_cast<T*>(container));
+		}
+
+		template<typename T>
+		void sequence_resize_erased(void* container, size_t size)
+		{
+			static_cast<T*>(container)->resize(size);
+		}
+
+		template<typename T>
+		void sequence_reserve_erased(void* container, size_t capacity)
+		{
+			static_cast<T*>(container)->reserve(capacity);
+		}
+
+		template<typename T>
+		void sequence_push_back_erased(void* container, const void* value)
+		{
+			static_cast<T*>(container)->push_back(*static_cast<const SequenceElement<T>*>(value));
+		}
+
+		template<typename T>
+		void container_clear_erased(void* container)
+		{
+			static_cast<T*>(container)->clear();
+		}
+
+		template<typename T>
+		TemplateTypeId type_id_erased()
+		{
+			return get_id<T>();
+		}
+
+		template<typename T>
+		constexpr SequenceOperations create_sequence_operations()
+		{
+			using TElement = SequenceElement<T>;
+
+			SequenceOperations operations{};
+			operations.size = &sequence_size_erased<T>;
+			operations.at = &sequence_at_erased<T>;
+			operations.element_type = &type_id_erased<TElement>;
+			operations.element_size = sizeof(TElement);
+			operations.element_trivially_copyable = std::is_trivially_copyable_v<TElement>;
+
+			if constexpr (std::ranges::contiguous_range<T>) {
+				operations.data = &sequence_data_erased<T>;
+			}
+			if constexpr (requires(T& container) { container.resize(size_t{}); }) {
+				operations.resize = &sequence_resize_erased<T>;
+			}
+			if constexpr (requires(T& container) { container.reserve(size_t{}); }) {
+				operations.reserve = &sequence_reserve_erased<T>;
+			}
+			if constexpr (requires(T& container, const TElement& value) { container.push_back(value); }) {
+				operations.push_back = &sequence_push_back_erased<T>;
+			}
+			if constexpr (requires(T& container) { container.clear(); }) {
+				operations.clear = &container_clear_erased<T>;
+			}
+
+			return operations;
+		}
+
+		template<typename T>
+		void* map_find_erased(void* container, const void* key)
+		{
+			T& map = *static_cast<T*>(container);
+			auto it = map.find(*static_cast<const typename T::key_type*>(key));
+			return it != map.end() ? std::addressof(it->second) : nullptr;
+		}
+
+		template<typename T>
+		void* map_insert_erased(void* container, const void* key, const void* value)
+		{
+			T& map = *static_cast<T*>(container);
+			auto [it, inserted] = map.insert_or_assign(*static_cast<const typename T::key_type*>(key), *static_cast<const typename T::mapped_type*>(value));
+			return std::addressof(it->second);
+		}
+
+		template<typename T>
+		bool map_erase_erased(void* container, const void* key)
+		{
+			return static_cast<T*>(container)->erase(*static_cast<const typename T::key_type*>(key)) > 0;
+		}
+
+		template<typename T>
+		void map_for_each_erased(void* container, MapOperations::Visitor visitor, void* context)
+		{
+			for (auto& [key, value] : *static_cast<T*>(container)) {
+				visitor(context, std::addressof(key), std::addressof(value));
+			}
+		}
+
+		template<typename T>
+		constexpr MapOperations create_map_operations()
+		{
+			using TKey = typename T::key_type;
+			using TMapped = typename T::mapped_type;
+
+			MapOperations operations{};
+			operations.size = &sequence_size_erased<T>;
+			operations.find = &map_find_erased<T>;
+			operations.erase = &map_erase_erased<T>;
+			operations.for_each = &map_for_each_erased<T>;
+			operations.key_type = &type_id_erased<TKey>;
+			operations.mapped_type = &type_id_erased<TMapped>;
+
+			if constexpr (requires(T& map, const TKey& key, const TMapped& value) { map.insert_or_assign(key, value); }) {
+				operations.insert = &map_insert_erased<T>;
+			}
+			if constexpr (requires(T& map) { map.reserve(size_t{}); }) {
+				operations.reserve = &sequence_reserve_erased<T>;
+			}
+			if constexpr (requires(T& map) { map.clear(); }) {
+				operations.clear = &container_clear_erased<T>;
+			}
+
+			return operations;
+		}
+	}
+
+	// Only function pointers, so these are constant initialised and safe to use during static initialisation.
+	template<ReflectableSequence T>
+	inline constexpr SequenceOperations sequence_operations_v = Detail::create_sequence_operations<T>();
+	template<ReflectableMap T>
+	inline constexpr MapOperations map_operations_v = Detail::create_map_operations<T>();
+
+	template<typename T>
+	constexpr const SequenceOperations* get_sequence_operations()
+	{
+		if constexpr (ReflectableSequence<T> && !ReflectableMap<T>) {
+			return &sequence_operations_v<T>;
+		} else {
+			return nullptr;
+		}
+	}
+
+	template<typename T>
+	constexpr const MapOperations* get_map_operations()
+	{
+		if constexpr (ReflectableMap<T>) {
+			return &map_operations_v<T>;
+		} else {
+			return nullptr;
+		}
+	}
+}
@@ -0,0 +1,219 @@
+// Non owning, type erased views over reflected containers, see `ContainerOperations.h` for the recognised containers.
+// Contiguous sequences expose their data, so trivially copyable elements can be copied in bulk instead of one at a time.
+#pragma once
+#include "neat/Defines.h"
+#include "neat/TemplateTypeId.h"
+#include "neat/Any.h"
+#include "neat/ContainerOperations.h"
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+
+
+namespace Neat
+{
+	class SequenceView
+	{
+	public:
+		// Construction
+		SequenceView() = default;
+		SequenceView(AnyPtr container, const SequenceOperations& operations);
+		REFL_API static SequenceView create(AnyPtr container); // Returns an invalid view if the type isn't registered or isn't a sequence
+		template<ReflectableSequence T>
+		static SequenceView create(T& container);
+
+		// Accessors
+		bool is_valid() const { return operations != nullptr; }
+		explicit operator bool() const { return is_valid(); }
+		AnyPtr container() const { return container_ptr; }
+		TemplateTypeId element_type() const { return element_type_id; }
+		size_t element_size() const { return operations->element_size; }
+
+		size_t size() const { return operations->size(container_ptr.value_ptr); }
+		bool empty() const { return size() == 0; }
+		AnyRef operator[](size_t index) const;
+
+		bool is_contiguous() const { return operations->data != nullptr; }
+		bool is_resizable() const { return operations->resize != nullptr; }
+		void* data() const; // nullptr when the sequence isn't contiguous
+
+		// Modifiers, need the container to support them
+		void reserve(size_t capacity) const; // A no-op for containers without `reserve`
+		void resize(size_t new_size) const;
+		void push_back(AnyConstRef value) const; // Copies the value
+		void clear() const;
+
+		// Replaces the contents with a copy of `count` elements, a single memcpy for contiguous trivially copyable elements.
+		// Fixed size sequences of other elements are assigned element by element, which needs the element type to be registered.
+		// Returns false when the sequence can't hold `count` elements, e.g. a fixed size sequence of another size.
+		REFL_API bool assign(const void* elements, size_t count) const;
+
+	private:
+		// Data
+		AnyPtr container_ptr{};
+		const SequenceOperations* operations = nullptr;
+		TemplateTypeId element_type_id = c_empty_type_id;
+	};
+
+	class MapView
+	{
+	public:
+		// Construction
+		MapView() = default;
+		MapView(AnyPtr container, const MapOperations& operations);
+		REFL_API static MapView create(AnyPtr container); // Returns an invalid view if the type isn't registered or isn't a map
+		template<ReflectableMap T>
+		static MapView create(T& container);
+
+		// Accessors
+		bool is_valid() const { return operations != nullptr; }
+		explicit operator bool() const { return is_valid(); }
+		AnyPtr container() const { return container_ptr; }
+		TemplateTypeId key_type() const { return key_type_id; }
+		TemplateTypeId mapped_type() const { return mapped_type_id; }
+
+		size_t size() const { return operations->size(container_ptr.value_ptr); }
+		bool empty() const { return size() == 0; }
+		AnyRef find(AnyConstRef key) const; // Returns an empty reference when the key isn't in the map
+
+		// Calls `visitor(AnyConstRef key, AnyRef value)` for every entry
+		template<typename TVisitor>
+		void for_each(TVisitor&& visitor) const;
+
+		// Modifiers, need the container to support them
+		AnyRef insert(AnyConstRef key, AnyConstRef value) const; // Copies both, overwrites the existing value
+		bool erase(AnyConstRef key) const;
+		void reserve(size_t capacity) const; // A no-op for containers without `reserve`
+		void clear() const;
+
+	private:
+		// Data
+		AnyPtr container_ptr{};
+		const MapOperations* operations = nullptr;
+		TemplateTypeId key_type_id = c_empty_type_id;
+		TemplateTypeId mapped_type_id = c_empty_type_id;
+	};
+}
+
+
+// Implementation
+namespace Neat
+{
+	inline SequenceView::SequenceView(AnyPtr container, const SequenceOperations& operations)
+		: container_ptr(container)
+		, operations(&operations)
+		, element_type_id(operations.element_type())
+	{
+	}
+
+	template<ReflectableSequence T>
+	SequenceView SequenceView::create(T& container)
+	{
+		return SequenceView{ AnyPtr{ std::addressof(container), get_id<T>() }, sequence_operations_v<T> };
+	}
+
+	inline AnyRef SequenceView::operator[](size_t index) const
+	{
+		assert(index < size());
+		return AnyRef{ operations->at(container_ptr.value_ptr, index), element_type_id };
+	}
+
+	inline void* SequenceView::data() const
+	{
+		return is_contiguous() ? operations->data(container_ptr.value_ptr) : nullptr;
+	}
+
+	inline void SequenceView::reserve(size_t capacity) const
+	{
+		if (operations->reserve != nullptr) {
+			operations->reserve(container_ptr.value_ptr, capacity);
+		}
+	}
+
+	inline void SequenceView::resize(size_t new_size) const
+	{
+		assert(is_resizable() && "The sequence has a fixed size.");
+		operations->resize(container_ptr.value_ptr, new_size);
+	}
+
+	inline void SequenceView::push_back(AnyConstRef value) const
+	{
+		assert(value.type_id == element_type_id);
+		assert(operations->push_back != nullptr && "The sequence doesn't support push_back.");
+		operations->push_back(container_ptr.value_ptr, value.value_ptr);
+	}
+
+	inline void SequenceView::clear() const
+	{
+		assert(operations->clear != nullptr && "The sequence can't be cleared.");
+		operations->clear(container_ptr.value_ptr);
+	}
+
+	inline MapView::MapView(AnyPtr container, const MapOperations& operations)
+		: container_ptr(container)
+		, operations(&operations)
+		, key_type_id(operations.key_type())
+		, mapped_type_id(operations.mapped_type())
+	{
+	}
+
+	template<ReflectableMap T>
+	MapView MapView::create(T& container)
+	{
+		return MapView{ AnyPtr{ std::addressof(container), get_id<T>() }, map_operations_v<T> };
+	}
+
+	inline AnyRef MapView::find(AnyConstRef key) const
+	{
+		assert(key.type_id == key_type_id);
+
+		void* value = operations->find(container_ptr.value_ptr, key.value_ptr);
+		return value != nullptr ? AnyRef{ value, mapped_type_id } : AnyRef{};
+	}
+
+	template<typename TVisitor>
+	void MapView::for_each(TVisitor&& visitor) const
+	{
+		struct Context
+		{
+			TVisitor& visitor;
+			TemplateTypeId key_type_id;
+			TemplateTypeId mapped_type_id;
+		};
+		Context context{ visitor, key_type_id, mapped_type_id };
+
+		operations->for_each(container_ptr.value_ptr, [](void* context_ptr, const void* key, void* value) {
+			Context& context = *static_cast<Context*>(context_ptr);
+			context.visitor(AnyConstRef{ key, context.key_type_id }, AnyRef{ value, context.mapped_type_id });
+		}, &context);
+	}
+
+	inline AnyRef MapView::insert(AnyConstRef key, AnyConstRef value) const
+	{
+		assert(key.type_id == key_type_id);
+		assert(value.type_id == mapped_type_id);
+		assert(operations->insert != nullptr && "The map's values aren't copyable.");
+
+		return AnyRef{ operations->insert(container_ptr.value_ptr, key.value_ptr, value.value_ptr), mapped_type_id };
+	}
+
+	inline bool MapView::erase(AnyConstRef key) const
+	{
+		assert(key.type_id == key_type_id);
+		return operations->erase(container_ptr.value_ptr, key.value_ptr);
+	}
+
+	inline void MapView::reserve(size_t capacity) const
+	{
+		if (operations->reserve != nullptr) {
+			operations->reserve(container_ptr.value_ptr, capacity);
+		}
+	}
+
+	inline void MapView::clear() const
+	{
+		assert(operations->clear != nullptr && "The map can't be cleared.");
+		operations->clear(container_ptr.value_ptr);
+	}
+}
@@ -0,0 +1,72 @@
+// Runtime conversions between type erased values.
+// Conversions are stored in a dense table indexed by type id, so `convert()` is a couple of loads and one indirect call.
+// Numeric widening/narrowing and number <-> std::string conversions are registered by default.
+#pragma once
+#include "neat/Defines.h"
+#include "neat/TemplateTypeId.h"
+#include "neat/Any.h"
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+
+namespace Neat
+{
+	// Returns an empty Any when the value couldn't be converted (e.g. a string which doesn't contain a number).
+	using ConvertFunction = Any (*)(AnyConstRef value);
+
+	// Registration, overwrites any existing conversion between the two types.
+	REFL_API void register_conversion(TemplateTypeId from, TemplateTypeId to, ConvertFunction function);
+	template<typename TFrom, typename TTo>
+	void register_conversion(); // Converts with `static_cast<TTo>`, floating point values outside of an integer's range (or NaN) fail
+
+	// Lookup, returns nullptr if no conversion is registered.
+	REFL_API ConvertFunction get_conversion(TemplateTypeId from, TemplateTypeId to);
+
+	// Conversion, returns an empty Any when no conversion is registered or the conversion failed.
+	// Converting to the type the value already has returns a copy.
+	REFL_API Any convert(const Any& value, TemplateTypeId to);
+	REFL_API Any convert(AnyConstRef value, TemplateTypeId to);
+}
+
+
+// Implementation
+namespace Neat
+{
+	namespace Detail
+	{
+		template<typename TInteger, typename TFloat>
+		bool is_in_integer_range(TFloat value)
+		{
+			// The cast truncates, so only the integral part needs to fit. NaN fails both comparisons.
+			const TFloat integral = std::trunc(value);
+			const TFloat upper = std::ldexp(TFloat{ 1 }, std::numeric_limits<TInteger>::digits);
+			const TFloat lower = std::is_signed_v<TInteger> ? -upper : TFloat{ 0 };
+			return integral >= lower && integral < upper;
+		}
+
+		template<typename TFrom, typename TTo>
+		Any static_cast_conversion_erased(AnyConstRef value)
+		{
+			const TFrom& from = value.get<TFrom>();
+
+			// Casting a floating point value which doesn't fit into the integer is undefined behaviour
+			if constexpr (std::is_floating_point_v<TFrom> && std::is_integral_v<TTo> && !std::is_same_v<TTo, bool>) {
+				if (!is_in_integer_range<TTo>(from)) {
+					return Any{};
+				}
+			}
+
+			return static_cast<TTo>(from);
+		}
+	}
+
+	template<typename TFrom, typename TTo>
+	void register_conversion()
+	{
+		static_assert(std::is_convertible_v<TFrom, TTo> || std::is_constructible_v<TTo, TFrom>, "TFrom needs to be convertible to TTo using `static_cast`");
+
+		register_conversion(get_id<TFrom>(), get_id<TTo>(), &Detail::static_cast_conversion_erased<TFrom, TTo>);
+	}
+}
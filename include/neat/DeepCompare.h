@@ -0,0 +1,25 @@
+// Structural equality and hashing of reflected objects, without user written operator== or std::hash.
+// Recurses into fields, base classes, containers (`SequenceView`, `MapView`) and owned pointees (`PointerView`).
+// Each type is compiled once into a plan, adjacent fields whose bytes fully represent their value are merged
+// into a single memcmp / hash over the bytes. Plans are cached per type and recompiled when the type is replaced.
+// Every reachable type needs to be registered. Like the registry, this isn't thread safe.
+#pragma once
+#include "neat/Defines.h"
+#include "neat/TemplateTypeId.h"
+#include "neat/Any.h"
+
+#include <cstddef>
+
+
+namespace Neat
+{
+	// Objects of different types are never equal.
+	// Owning pointers compare their pointees, two empty pointers are equal. Cycles through owning pointers are
+	// followed once. Raw pointers compare by address, they don't own what they point to and often point back up.
+	// Types with a base which can't be reached (no upcast, e.g. a private base) use their operator== and std::hash instead
+	// of their members. Without those they can't be compared, this asserts and returns false.
+	REFL_API bool deep_equal(AnyPtr a, AnyPtr b);
+
+	// Objects which are `deep_equal` have the same hash. Maps hash independent of their iteration order.
+	REFL_API size_t deep_hash(AnyPtr object);
+}
@@ -0,0 +1,61 @@
+// Field level deltas between two objects of the same type, e.g. to replicate only the changed state to a mirror.
+// Each type is compiled once into a plan. Adjacent fields whose bytes fully represent their value are compared with
+// a single memcmp, and only the changed span of such a run is written to the patch.
+// Recurses into fields, base classes, sequences (`SequenceView`) and owning pointers (`PointerView`).
+// Every reachable type needs to be registered. Like the registry, this isn't thread safe.
+#pragma once
+#include "neat/Defines.h"
+#include "neat/TemplateTypeId.h"
+#include "neat/Any.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+namespace Neat
+{
+	// A serialised list of changes, the bytes can be sent as is.
+	// Each change is encoded as
+	//     op: u8, depth: u8, path: u32[depth], payload
+	// The path indexes members (the bases first, then the fields in declaration order), sequence elements
+	// or `c_patch_pointee` for the pointee of a pointer. The payload depends on the op:
+	//     Assign: size: u32, bytes[size]   The new bytes of a run of fields, or the elements of a sequence
+	//     Resize: size: u32                The new size of a sequence, new elements are followed by their changes
+	//     Emplace, Reset: nothing          A pointer gets a new default constructed pointee, or is reset
+	// Integers and values are stored in native byte order and layout, both ends need the same build of the types.
+	struct Patch
+	{
+		enum class Op : uint8_t
+		{
+			Assign,
+			Resize,
+			Emplace,
+			Reset,
+		};
+
+		// Accessors
+		bool empty() const { return data.empty(); }
+		std::span<const std::byte> bytes() const { return data; }
+
+		// Data
+		std::vector<std::byte> data;
+	};
+
+	inline constexpr uint32_t c_patch_pointee = UINT32_MAX;
+
+	// `apply_patch` rejects a resize which grows a sequence to more bytes than this.
+	inline constexpr size_t c_max_patch_sequence_bytes = 64 * 1024 * 1024;
+
+	// Overwrites `patch` with the changes needed to turn `old_object` into `new_object`.
+	// Returns false when some change can't be represented, these changes are missing. E.g. changes in a map, to a raw pointer,
+	// to a pointee of a derived type or to a base class without an upcast.
+	REFL_API bool diff(AnyPtr old_object, AnyPtr new_object, Patch& patch);
+
+	// The object needs to be of the type the patch was created for, and equal to the old object for the result to equal the new object.
+	// Returns false when the patch is malformed or doesn't match the object, the changes before the bad one are applied.
+	// Sequences aren't grown past `c_max_patch_sequence_bytes`.
+	// bools and enums with a registered `Enum` only accept valid values (enumerators or combinations of flag enumerators).
+	REFL_API bool apply_patch(AnyPtr object, std::span<const std::byte> patch);
+}
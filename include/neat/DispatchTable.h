@@ -0,0 +1,287 @@
+// Type dispatch over type erased objects, built once from a set of typed handlers.
+// Handlers are stored in a dense table indexed by type id, so `visit()` is one indexed load plus one indirect call,
+// instead of an if-chain which compares the type id with every handled type.
+#pragma once
+#include "neat/Defines.h"
+#include "neat/TemplateTypeId.h"
+#include "neat/Any.h"
+#include "neat/Reflection.h"
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+namespace Neat
+{
+	template<typename TSignature>
+	class DispatchTable;
+
+	// Handlers take the object as their first parameter, followed by the table's arguments: `R handler(T& object, TArgs... args)`.
+	// The object type is deduced from the first parameter, use `add<T>()` for generic lambdas. Handlers are called as const.
+	template<typename R, typename... TArgs>
+	class DispatchTable<R(TArgs...)>
+	{
+	public:
+		// Construction
+		DispatchTable() = default;
+		template<typename... THandlers>
+		static DispatchTable create(THandlers&&... handlers);
+
+		template<typename THandler>
+		void add(THandler&& handler); // Overwrites an existing handler for the same type
+		template<typename T, typename THandler>
+		void add(THandler&& handler);
+
+		// Called for objects without a handler: `R handler(AnyPtr object, TArgs... args)`.
+		template<typename THandler>
+		void set_default(THandler&& handler);
+
+		// Adds entries for every registered type which has no handler, but (indirectly) derives from a type which has one.
+		// The nearest handled base is used, bases are searched in declaration order. Call after the types are registered.
+		void add_base_class_fallback();
+
+		// Accessors
+		bool contains(TemplateTypeId type_id) const { return find(type_id) != nullptr; }
+
+		// Dispatch, the object needs a handler or there has to be a default handler.
+		R operator()(AnyPtr object, TArgs... args) const;
+
+	private:
+		using Thunk = R (*)(const void* handler, void* object, TArgs... args);
+		using DefaultThunk = R (*)(const void* handler, AnyPtr object, TArgs... args);
+
+		static constexpr uint32_t c_no_base_path = UINT32_MAX;
+
+		struct Entry
+		{
+			Thunk thunk = nullptr;
+			const void* handler = nullptr;
+			uint32_t base_path = c_no_base_path; // Index into `base_paths`, set for entries added by the base class fallback
+		};
+
+		// Helpers
+		const Entry* find(TemplateTypeId type_id) const;
+		void set_entry(TemplateTypeId type_id, const Entry& entry);
+		const Entry* find_base_handler(TemplateTypeId type_id, std::vector<BaseClass::UpcastFunction>& path) const;
+		R call_default(AnyPtr object, TArgs... args) const;
+
+		template<typename THandler>
+		const void* store_handler(THandler&& handler);
+
+		// Data
+		// Ids from the automatic id counter are small, so they index into the dense table.
+		// Manually assigned ids can be arbitrarily large, these go into a sparse map instead.
+		static constexpr TemplateTypeId c_max_dense_id = 4096;
+		std::vector<Entry> dense;
+		std::unordered_map<TemplateTypeId, Entry> sparse;
+
+		std::vector<std::vector<BaseClass::UpcastFunction>> base_paths;
+		std::vector<std::shared_ptr<const void>> handlers; // Shared, so copies of the table can share their handlers
+
+		DefaultThunk default_thunk = nullptr;
+		const void* default_handler = nullptr;
+	};
+
+	// Calls the handler for the object's type.
+	template<typename R, typename... TArgs>
+	R visit(AnyPtr object, const DispatchTable<R(TArgs...)>& table, std::type_identity_t<TArgs>... args);
+}
+
+
+// Implementation
+namespace Neat
+{
+	namespace Detail
+	{
+		// The type of the first parameter of a handler
+		template<typename T>
+		struct DispatchHandlerObject : DispatchHandlerObject<decltype(&T::operator())> {};
+
+		template<typename R, typename TObject, typename... TArgs>
+		struct DispatchHandlerObject<R (*)(TObject, TArgs...)> { using Type = std::remove_cvref_t<TObject>; };
+		template<typename R, typename TObject, typename... TArgs>
+		struct DispatchHandlerObject<R (*)(TObject, TArgs...) noexcept> { using Type = std::remove_cvref_t<TObject>; };
+		template<typename R, typename TClass, typename TObject, typename... TArgs>
+		struct DispatchHandlerObject<R (TClass::*)(TObject, TArgs...) const> { using Type = std::remove_cvref_t<TObject>; };
+		template<typename R, typename TClass, typename TObject, typename... TArgs>
+		struct DispatchHandlerObject<R (TClass::*)(TObject, TArgs...) const noexcept> { using Type = std::remove_cvref_t<TObject>; };
+
+		template<typename THandler, typename TObject, typename R, typename... TArgs>
+		R dispatch_handler_erased(const void* handler, void* object, TArgs... args)
+		{
+			return (*static_cast<const THandler*>(handler))(*static_cast<TObject*>(object), std::forward<TArgs>(args)...);
+		}
+
+		template<typename THandler, typename R, typename... TArgs>
+		R dispatch_default_handler_erased(const void* handler, AnyPtr object, TArgs... args)
+		{
+			return (*static_cast<const THandler*>(handler))(object, std::forward<TArgs>(args)...);
+		}
+	}
+
+	template<typename R, typename... TArgs>
+	template<typename... THandlers>
+	DispatchTable<R(TArgs...)> DispatchTable<R(TArgs...)>::create(THandlers&&... handlers)
+	{
+		DispatchTable table{};
+		(table.add(std::forward<THandlers>(handlers)), ...);
+		return table;
+	}
+
+	template<typename R, typename... TArgs>
+	template<typename THandler>
+	void DispatchTable<R(TArgs...)>::add(THandler&& handler)
+	{
+		using TObject = typename Detail::DispatchHandlerObject<std::decay_t<THandler>>::Type;
+		add<TObject>(std::forward<THandler>(handler));
+	}
+
+	template<typename R, typename... TArgs>
+	template<typename T, typename THandler>
+	void DispatchTable<R(TArgs...)>::add(THandler&& handler)
+	{
+		using THandlerStorage = std::decay_t<THandler>;
+		static_assert(std::is_invocable_r_v<R, const THandlerStorage&, T&, TArgs...>, "The handler needs to be callable as `R(T& object, TArgs... args)`.");
+
+		const void* stored_handler = store_handler(std::forward<THandler>(handler));
+		set_entry(get_id<T>(), Entry{ &Detail::dispatch_handler_erased<THandlerStorage, T, R, TArgs...>, stored_handler });
+	}
+
+	template<typename R, typename... TArgs>
+	template<typename THandler>
+	void DispatchTable<R(TArgs...)>::set_default(THandler&& handler)
+	{
+		using THandlerStorage = std::decay_t<THandler>;
+		static_assert(std::is_invocable_r_v<R, const THandlerStorage&, AnyPtr, TArgs...>, "The default handler needs to be callable as `R(AnyPtr object, TArgs... args)`.");
+
+		default_handler = store_handler(std::forward<THandler>(handler));
+		default_thunk = &Detail::dispatch_default_handler_erased<THandlerStorage, R, TArgs...>;
+	}
+
+	template<typename R, typename... TArgs>
+	template<typename THandler>
+	const void* DispatchTable<R(TArgs...)>::store_handler(THandler&& handler)
+	{
+		auto stored_handler = std::make_shared<const std::decay_t<THandler>>(std::forward<THandler>(handler));
+		const void* address = stored_handler.get();
+		handlers.push_back(std::move(stored_handler));
+		return address;
+	}
+
+	template<typename R, typename... TArgs>
+	void DispatchTable<R(TArgs...)>::set_entry(TemplateTypeId type_id, const Entry& entry)
+	{
+		if (type_id >= c_max_dense_id) {
+			sparse[type_id] = entry;
+			return;
+		}
+
+		if (type_id >= dense.size()) {
+			dense.resize(type_id + 1);
+		}
+		dense[type_id] = entry;
+	}
+
+	template<typename R, typename... TArgs>
+	auto DispatchTable<R(TArgs...)>::find(TemplateTypeId type_id) const -> const Entry*
+	{
+		if (type_id < dense.size()) [[likely]] {
+			const Entry& entry = dense[type_id];
+			return entry.thunk != nullptr ? &entry : nullptr;
+		}
+
+		if (type_id < c_max_dense_id) {
+			return nullptr;
+		}
+
+		auto it = sparse.find(type_id);
+		return it != sparse.end() ? &it->second : nullptr;
+	}
+
+	template<typename R, typename... TArgs>
+	auto DispatchTable<R(TArgs...)>::find_base_handler(TemplateTypeId type_id, std::vector<BaseClass::UpcastFunction>& path) const -> const Entry*
+	{
+		const Type* type = get_type(type_id);
+		if (type == nullptr) {
+			return nullptr;
+		}
+
+		for (const BaseClass& base : type->bases) {
+			if (base.upcast == nullptr) {
+				continue;
+			}
+
+			path.push_back(base.upcast);
+
+			// Only direct handlers, so the path doesn't depend on the order entries were added in.
+			const Entry* entry = find(base.base_id);
+			if (entry != nullptr && entry->base_path == c_no_base_path) {
+				return entry;
+			}
+
+			if (const Entry* base_entry = find_base_handler(base.base_id, path)) {
+				return base_entry;
+			}
+
+			path.pop_back();
+		}
+
+		return nullptr;
+	}
+
+	template<typename R, typename... TArgs>
+	void DispatchTable<R(TArgs...)>::add_base_class_fallback()
+	{
+		for (const Type& type : get_types()) {
+			if (contains(type.id)) {
+				continue;
+			}
+
+			std::vector<BaseClass::UpcastFunction> path;
+			const Entry* base_entry = find_base_handler(type.id, path);
+			if (base_entry == nullptr) {
+				continue;
+			}
+
+			Entry entry = *base_entry;
+			entry.base_path = static_cast<uint32_t>(base_paths.size());
+			base_paths.push_back(std::move(path));
+			set_entry(type.id, entry);
+		}
+	}
+
+	template<typename R, typename... TArgs>
+	R DispatchTable<R(TArgs...)>::call_default(AnyPtr object, TArgs... args) const
+	{
+		assert(default_thunk != nullptr && "No handler for the object's type, and no default handler.");
+		return default_thunk(default_handler, object, std::forward<TArgs>(args)...);
+	}
+
+	template<typename R, typename... TArgs>
+	R DispatchTable<R(TArgs...)>::operator()(AnyPtr object, TArgs... args) const
+	{
+		const Entry* entry = find(object.type_id);
+		if (entry == nullptr) [[unlikely]] {
+			return call_default(object, std::forward<TArgs>(args)...);
+		}
+
+		if (entry->base_path != c_no_base_path) [[unlikely]] {
+			for (BaseClass::UpcastFunction upcast : base_paths[entry->base_path]) {
+				object = upcast(object);
+			}
+		}
+
+		return entry->thunk(entry->handler, object.value_ptr, std::forward<TArgs>(args)...);
+	}
+
+	template<typename R, typename... TArgs>
+	R visit(AnyPtr object, const DispatchTable<R(TArgs...)>& table, std::type_identity_t<TArgs>... args)
+	{
+		return table(object, std::forward<TArgs>(args)...);
+	}
+}
@@ -0,0 +1,154 @@
+// Reflected enumerations, name <-> value lookups for enums.
+// Value to name is a dense table indexed by value when the enumerators are close together, otherwise a binary search.
+// Name to value goes through a perfect hash built when the enum is registered, so both directions are O(1) or close to it.
+#pragma once
+#include "neat/Defines.h"
+#include "neat/TemplateTypeId.h"
+#include "neat/Any.h"
+
+#include <compare>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+// Forward Declarations
+namespace Neat
+{
+	class Enum;
+}
+
+
+namespace Neat
+{
+	// Functions
+	// ===========================================================================
+
+	REFL_API Enum& add_enum(Enum&&);
+
+	REFL_API std::span<const Enum> get_enums();
+	REFL_API const Enum* get_enum(std::string_view enum_name);
+	REFL_API const Enum* get_enum(TemplateTypeId type_id);
+	template<typename T>
+	const Enum* get_enum() { return get_enum(get_id<T>()); }
+
+
+	// Types
+	// ===========================================================================
+
+	struct Enumerator
+	{
+		// Data
+		std::string name;
+		int64_t value; // Unsigned values are stored with the same bits
+
+		// Operators
+		auto operator<=>(const Enumerator& other) const noexcept = default;
+	};
+
+	class Enum
+	{
+	public:
+		// Construction
+		template<typename TEnum>
+		static Enum create(std::string_view name, std::initializer_list<std::pair<std::string_view, TEnum>> enumerators);
+		REFL_API Enum(std::string name, TemplateTypeId id, TemplateTypeId underlying_type, size_t size, bool is_signed, std::vector<Enumerator> enumerators);
+
+		// Accessors
+		const std::string& name() const { return enum_name; }
+		TemplateTypeId id() const { return type_id; }
+		TemplateTypeId underlying_type() const { return underlying_type_id; }
+		size_t size() const { return value_size; }
+		std::span<const Enumerator> enumerators() const { return enumerator_list; }
+
+		// Lookup, an empty string_view / nullopt when there is no such enumerator.
+		// When several enumerators share a value, the first one is found.
+		REFL_API std::string_view to_name(int64_t value) const;
+		REFL_API std::optional<int64_t> to_value(std::string_view name) const;
+		template<typename TEnum>
+		std::string_view to_name(TEnum value) const requires std::is_enum_v<TEnum>;
+		template<typename TEnum>
+		std::optional<TEnum> to_value(std::string_view name) const;
+
+		// Flag enums
+		// Returns the names of the enumerators whose bits are all set in `value`, enumerators with more bits go first.
+		// Bits which no enumerator covers are written to `out_remaining_bits`.
+		REFL_API std::vector<std::string_view> decompose(int64_t value, int64_t* out_remaining_bits = nullptr) const;
+		// Parses names separated by `separator` (e.g. "Read|Write"), nullopt when a name isn't an enumerator.
+		REFL_API std::optional<int64_t> compose(std::string_view names, char separator = '|') const;
+
+		// Type erased access to values of this enum.
+		REFL_API int64_t get_value(AnyConstRef value) const;
+		REFL_API void set_value(AnyRef value, int64_t new_value) const;
+
+		// Operators
+		bool operator==(const Enum& other) const noexcept { return type_id == other.type_id; }
+		std::strong_ordering operator<=>(const Enum& other) const noexcept { return type_id <=> other.type_id; }
+
+	private:
+		// Helpers
+		void build_value_lookup();
+		void build_name_lookup();
+		uint32_t find_name_slot(std::string_view name) const;
+
+		// Data
+		std::string enum_name;
+		TemplateTypeId type_id;
+		TemplateTypeId underlying_type_id;
+		size_t value_size;
+		bool is_signed;
+		std::vector<Enumerator> enumerator_list;
+
+		// Value to name, either `dense_indices` (indexed by value - `min_value`) or `sorted_values` is used.
+		int64_t min_value = 0;
+		std::vector<int32_t> dense_indices; // -1 for values without an enumerator
+		std::vector<std::pair<int64_t, uint32_t>> sorted_values;
+
+		// Name to value, a hash and displace perfect hash.
+		std::vector<uint32_t> bucket_seeds;
+		std::vector<int32_t> name_slots; // Enumerator index per slot, -1 for empty slots
+	};
+}
+
+
+// Implementation
+namespace Neat
+{
+	template<typename TEnum>
+	Enum Enum::create(std::string_view name, std::initializer_list<std::pair<std::string_view, TEnum>> enumerators)
+	{
+		static_assert(std::is_enum_v<TEnum>, "TEnum needs to be an enumeration.");
+		using Underlying = std::underlying_type_t<TEnum>;
+
+		std::vector<Enumerator> enumerator_list;
+		enumerator_list.reserve(enumerators.size());
+		for (const auto& [enumerator_name, value] : enumerators) {
+			enumerator_list.push_back(Enumerator{ std::string{ enumerator_name }, static_cast<int64_t>(static_cast<Underlying>(value)) });
+		}
+
+		return Enum{ std::string{ name }, get_id<TEnum>(), get_id<Underlying>(), sizeof(TEnum), std::is_signed_v<Underlying>, std::move(enumerator_list) };
+	}
+
+	template<typename TEnum>
+	std::string_view Enum::to_name(TEnum value) const requires std::is_enum_v<TEnum>
+	{
+		return to_name(static_cast<int64_t>(static_cast<std::underlying_type_t<TEnum>>(value)));
+	}
+
+	template<typename TEnum>
+	std::optional<TEnum> Enum::to_value(std::string_view name) const
+	{
+		auto value = to_value(name);
+		if (!value) {
+			return std::nullopt;
+		}
+
+		return static_cast<TEnum>(static_cast<std::underlying_type_t<TEnum>>(*value));
+	}
+}
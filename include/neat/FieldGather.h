@@ -0,0 +1,24 @@
+// Bulk copies of one field out of, or into, an array of reflected objects (AoS <-> SoA).
+// Fields with a fixed offset and a trivially copyable type are copied with strided loads and stores,
+// using AVX2 gathers when the CPU supports them. Other fields go through `Field::get_address` and the field type's copy functions.
+#pragma once
+#include "neat/Defines.h"
+#include "neat/Any.h"
+#include "neat/Reflection.h"
+
+#include <cstddef>
+
+
+namespace Neat
+{
+	// `objects` points to the first of `count` objects of type `field.object_type`, which are `stride` bytes apart.
+	// `out` points to uninitialised storage for `count` tightly packed values of type `field.type`.
+	REFL_API void gather(const Field& field, AnyPtr objects, size_t stride, size_t count, void* out);
+
+	// `values` points to `count` tightly packed values of type `field.type`, which are copy assigned to the objects' fields.
+	REFL_API void scatter(const Field& field, AnyPtr objects, size_t stride, size_t count, const void* values);
+
+	// Strided kernels for trivially copyable values, `first` points to the value inside the first object.
+	REFL_API void gather_strided(const void* first, size_t stride, size_t count, size_t size, void* out);
+	REFL_API void scatter_strided(void* first, size_t stride, size_t count, size_t size, const void* values);
+}
@@ -0,0 +1,121 @@
+// Typed access to a reflected field, resolved once from a Field.
+// Reading through a handle is a pointer plus offset when the field has a fixed offset,
+// otherwise it is a single call to `Field::get_address`. Nothing is copied or boxed in an Any.
+#pragma once
+#include "neat/Defines.h"
+#include "neat/TemplateTypeId.h"
+#include "neat/Any.h"
+#include "neat/Reflection.h"
+#include "neat/ChangeTracking.h"
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+
+namespace Neat
+{
+	template<typename T>
+	class FieldHandle
+	{
+	public:
+		// Construction
+		FieldHandle() = default;
+		static FieldHandle create(const Field& field); // Returns an invalid handle if the field's type isn't T
+
+		// Accessors
+		bool is_valid() const { return object_type_id != c_empty_type_id; }
+		explicit operator bool() const { return is_valid(); }
+		TemplateTypeId object_type() const { return object_type_id; }
+		size_t field_index() const { return index; }
+
+		// Field access, the object needs to be of the type the field belongs to.
+		T& ref(AnyRef object) const;
+		const T& get(AnyRef object) const;
+		const T& get(AnyConstRef object) const;
+		template<NotAnyWrapper TObject> requires (!std::is_const_v<TObject>)
+		const T& get(TObject& object) const; // Both references convert from a mutable object, this picks `AnyRef`
+		void set(AnyRef object, const T& value) const; // Marks the field dirty when the object is tracked, see `ChangeTracking.h`
+
+	private:
+		// Helpers
+		void* field_address(void* object) const;
+
+		// Data
+		size_t offset = 0;
+		Field::GetAddressFunction get_address = nullptr; // Only used when the field has no fixed offset
+		TemplateTypeId object_type_id = c_empty_type_id;
+		size_t index = 0;
+		bool has_offset = false;
+	};
+}
+
+
+// Implementation
+namespace Neat
+{
+	template<typename T>
+	FieldHandle<T> FieldHandle<T>::create(const Field& field)
+	{
+		static_assert(std::is_same_v<T, std::remove_cvref_t<T>>, "T needs to be the unqualified field type.");
+
+		FieldHandle handle{};
+		if (field.type != get_id<T>()) {
+			return handle;
+		}
+
+		handle.object_type_id = field.object_type;
+		handle.get_address = field.get_address;
+		handle.has_offset = field.offset.has_value();
+		handle.offset = field.offset.value_or(0);
+		handle.index = field.index;
+		return handle;
+	}
+
+	template<typename T>
+	void* FieldHandle<T>::field_address(void* object) const
+	{
+		if (has_offset) {
+			return static_cast<std::byte*>(object) + offset;
+		}
+
+		return get_address(AnyPtr{ object, object_type_id }).value_ptr;
+	}
+
+	template<typename T>
+	T& FieldHandle<T>::ref(AnyRef object) const
+	{
+		assert(is_valid());
+		assert(object.type_id == object_type_id);
+
+		return *static_cast<T*>(field_address(object.value_ptr));
+	}
+
+	template<typename T>
+	const T& FieldHandle<T>::get(AnyRef object) const
+	{
+		return ref(object);
+	}
+
+	template<typename T>
+	const T& FieldHandle<T>::get(AnyConstRef object) const
+	{
+		return ref(AnyRef{ const_cast<void*>(object.value_ptr), object.type_id });
+	}
+
+	template<typename T>
+	template<NotAnyWrapper TObject> requires (!std::is_const_v<TObject>)
+	const T& FieldHandle<T>::get(TObject& object) const
+	{
+		return ref(AnyRef{ object });
+	}
+
+	template<typename T>
+	void FieldHandle<T>::set(AnyRef object, const T& value) const
+	{
+		ref(object) = value;
+		if (Detail::tracked_object_count != 0) {
+			mark_dirty(object.to_any_ptr(), index);
+		}
+	}
+}
@@ -0,0 +1,102 @@
+// A dotted path to a nested field, e.g. "sub_object.factor", resolved once against the reflected types.
+// Consecutive hops through fields with a fixed offset are folded together, so a path through plain structs is a single offset.
+// Only the type's own fields are searched, fields of base classes aren't reachable through a path.
+#pragma once
+#include "neat/Defines.h"
+#include "neat/TemplateTypeId.h"
+#include "neat/Any.h"
+#include "neat/Reflection.h"
+
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+
+namespace Neat
+{
+	class FieldPath
+	{
+	public:
+		// Construction
+		FieldPath() = default;
+		REFL_API static FieldPath compile(const Type& type, std::string_view path); // Returns an invalid path if a field can't be found
+		REFL_API static FieldPath compile(TemplateTypeId type_id, std::string_view path);
+
+		// Accessors
+		bool is_valid() const { return object_type_id != c_empty_type_id; }
+		explicit operator bool() const { return is_valid(); }
+		TemplateTypeId object_type() const { return object_type_id; }
+		TemplateTypeId type() const { return leaf_type_id; }
+		std::optional<size_t> offset() const { return total_offset; } // Set when every hop has a fixed offset
+
+		// Access, the object needs to be of the path's object type.
+		REFL_API AnyRef resolve(AnyRef object) const;
+		REFL_API AnyConstRef resolve(AnyConstRef object) const;
+		template<NotAnyWrapper TObject> requires (!std::is_const_v<TObject>)
+		AnyRef resolve(TObject& object) const; // Both references convert from a mutable object, this picks `AnyRef`
+		REFL_API Any get_value(AnyPtr object) const;
+		REFL_API void set_value(AnyPtr object, Any value) const; // The last field can't be const
+
+		template<typename T>
+		const T& get(AnyConstRef object) const;
+		template<typename T>
+		void set(AnyRef object, const T& value) const;
+
+		// Batch access over `count` objects which are `stride` bytes apart, see `Neat::gather` and `Neat::scatter`.
+		REFL_API void gather(AnyPtr objects, size_t stride, size_t count, void* out) const;
+		REFL_API void scatter(AnyPtr objects, size_t stride, size_t count, const void* values) const;
+
+	private:
+		// A field which doesn't have a fixed offset, reached after adding `offset_before` to the current address.
+		struct Hop
+		{
+			size_t offset_before;
+			Field::GetAddressFunction get_address;
+			TemplateTypeId object_type;
+		};
+
+		// Helpers
+		void* resolve_parent(void* object) const;
+		void* resolve_address(void* object) const;
+
+		// Data
+		std::vector<Hop> parent_hops; // Hops up to the object which holds the last field
+		size_t parent_offset = 0; // Added after the last hop
+		std::optional<size_t> leaf_offset;
+		Field::GetAddressFunction leaf_get_address = nullptr;
+		Field::GetValueFunction leaf_get_value = nullptr;
+		Field::SetValueFunction leaf_set_value = nullptr;
+		TemplateTypeId leaf_object_type_id = c_empty_type_id;
+		TemplateTypeId leaf_type_id = c_empty_type_id;
+		size_t leaf_size = 0;
+		TypeFlags leaf_type_flags = TypeFlags::None;
+		std::optional<size_t> total_offset;
+		TemplateTypeId object_type_id = c_empty_type_id;
+	};
+}
+
+
+// Implementation
+namespace Neat
+{
+	template<NotAnyWrapper TObject> requires (!std::is_const_v<TObject>)
+	AnyRef FieldPath::resolve(TObject& object) const
+	{
+		return resolve(AnyRef{ object });
+	}
+
+	template<typename T>
+	const T& FieldPath::get(AnyConstRef object) const
+	{
+		return resolve(object).get<T>();
+	}
+
+	template<typename T>
+	void FieldPath::set(AnyRef object, const T& value) const
+	{
+		resolve(object).get<T>() = value;
+	}
+}
@@ -0,0 +1,172 @@
+// Type erased access to the value behind pointer-like types, instantiated once per pointer type.
+// Recognises std::optional, std::unique_ptr, std::shared_ptr and raw pointers. Used by `PointerView`.
+#pragma once
+#include "neat/Defines.h"
+#include "neat/TemplateTypeId.h"
+#include "neat/Any.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <typeinfo>
+
+
+namespace Neat
+{
+	enum class PointerKind : uint8_t { Raw, Optional, UniquePtr, SharedPtr };
+
+	struct PointerOperations
+	{
+		using GetFunction = AnyPtr (*)(void* pointer); // Empty when there's no value
+		using ResetFunction = void (*)(void* pointer);
+		using EmplaceFunction = AnyPtr (*)(void* pointer); // Value initialises a new pointee, replacing the old one
+		using TypeIdFunction = TemplateTypeId (*)();
+
+		// Functions, nullptr when the pointer doesn't support the operation.
+		GetFunction get = nullptr; // Polymorphic pointees report their dynamic type when it's registered, see `get_type(const std::type_info&)`
+		ResetFunction reset = nullptr; // Raw pointers are set to nullptr without deleting the pointee
+		EmplaceFunction emplace = nullptr; // Only for owning pointers
+		TypeIdFunction pointee_type = nullptr; // The static type
+
+		// Data
+		PointerKind kind = PointerKind::Raw;
+		bool is_owning = false;
+	};
+
+	namespace Detail
+	{
+		template<typename T>
+		struct PointerTraits {};
+
+		template<typename T>
+		struct PointerTraits<T*> { using Pointee = T; static constexpr PointerKind kind = PointerKind::Raw; };
+		template<typename T>
+		struct PointerTraits<std::optional<T>> { using Pointee = T; static constexpr PointerKind kind = PointerKind::Optional; };
+		template<typename T, typename TDeleter>
+		struct PointerTraits<std::unique_ptr<T, TDeleter>> { using Pointee = T; static constexpr PointerKind kind = PointerKind::UniquePtr; };
+		template<typename T>
+		struct PointerTraits<std::shared_ptr<T>> { using Pointee = T; static constexpr PointerKind kind = PointerKind::SharedPtr; };
+
+		// Registry lookup of a polymorphic object's dynamic type, c_empty_type_id when that type isn't registered.
+		REFL_API TemplateTypeId get_registered_type_id(const std::type_info& type_info);
+	}
+
+	// Pointers to objects, function pointers and arrays (`std::unique_ptr<T[]>`) are excluded.
+	template<typename T>
+	concept ReflectablePointer = requires { typename Detail::PointerTraits<T>::Pointee; }
+		&& std::is_object_v<typename Detail::PointerTraits<T>::Pointee>
+		&& !std::is_array_v<typename Detail::PointerTraits<T>::Pointee>;
+
+	// nullptr when T isn't a recognised pointer
+	template<typename T>
+	constexpr const PointerOperations* get_pointer_operations();
+}
+
+
+// Implementation
+namespace Neat
+{
+	namespace Detail
+	{
+		template<typename T>
+		AnyPtr pointer_get_erased(void* pointer)
+		{
+			using TPointee = typename PointerTraits<T>::Pointee;
+			using TCleanPointee = std::remove_cv_t<TPointee>;
+
+			T& pointer_ = *static_cast<T*>(pointer);
+			TPointee* pointee = nullptr;
+			if constexpr (PointerTraits<T>::kind == PointerKind::Raw) {
+				pointee = pointer_;
+			} else if constexpr (PointerTraits<T>::kind == PointerKind::Optional) {
+				pointee = pointer_.has_value() ? std::addressof(*pointer_) : nullptr;
+			} else {
+				pointee = pointer_.get();
+			}
+
+			if (pointee == nullptr) {
+				return AnyPtr{};
+			}
+
+			if constexpr (std::is_polymorphic_v<TCleanPointee>) {
+				const TemplateTypeId dynamic_type_id = get_registered_type_id(typeid(*pointee));
+				if (dynamic_type_id != c_empty_type_id) {
+					return AnyPtr{ const_cast<void*>(dynamic_cast<const volatile void*>(pointee)), dynamic_type_id };
+				}
+			}
+
+			return AnyPtr{ const_cast<TCleanPointee*>(pointee), get_id<TCleanPointee>() };
+		}
+
+		template<typename T>
+		void pointer_reset_erased(void* pointer)
+		{
+			T& pointer_ = *static_cast<T*>(pointer);
+			if constexpr (PointerTraits<T>::kind == PointerKind::Raw) {
+				pointer_ = nullptr;
+			} else {
+				pointer_.reset();
+			}
+		}
+
+		template<typename T>
+		AnyPtr pointer_emplace_erased(void* pointer)
+		{
+			using TPointee = typename PointerTraits<T>::Pointee;
+
+			T& pointer_ = *static_cast<T*>(pointer);
+			if constexpr (PointerTraits<T>::kind == PointerKind::Optional) {
+				pointer_.emplace();
+			} else if constexpr (PointerTraits<T>::kind == PointerKind::UniquePtr) {
+				pointer_.reset(new TPointee());
+			} else {
+				pointer_ = std::make_shared<TPointee>();
+			}
+
+			return AnyPtr{ const_cast<std::remove_cv_t<TPointee>*>(std::addressof(*pointer_)), get_id<std::remove_cv_t<TPointee>>() };
+		}
+
+		template<typename T>
+		TemplateTypeId pointee_type_id_erased()
+		{
+			return get_id<std::remove_cv_t<typename PointerTraits<T>::Pointee>>();
+		}
+
+		template<typename T>
+		constexpr PointerOperations create_pointer_operations()
+		{
+			using TPointee = typename PointerTraits<T>::Pointee;
+			constexpr PointerKind kind = PointerTraits<T>::kind;
+
+			PointerOperations operations{};
+			operations.get = &pointer_get_erased<T>;
+			operations.reset = &pointer_reset_erased<T>;
+			operations.pointee_type = &pointee_type_id_erased<T>;
+			operations.kind = kind;
+			operations.is_owning = (kind != PointerKind::Raw);
+
+			// Custom deleters might not match `new`, only emplace into unique_ptrs with the default deleter.
+			constexpr bool can_allocate = (kind != PointerKind::UniquePtr) || std::is_same_v<T, std::unique_ptr<TPointee>>;
+			if constexpr (kind != PointerKind::Raw && can_allocate && std::is_default_constructible_v<TPointee>) {
+				operations.emplace = &pointer_emplace_erased<T>;
+			}
+
+			return operations;
+		}
+	}
+
+	// Only function pointers, so these are constant initialised and safe to use during static initialisation.
+	template<ReflectablePointer T>
+	inline constexpr PointerOperations pointer_operations_v = Detail::create_pointer_operations<T>();
+
+	template<typename T>
+	constexpr const PointerOperations* get_pointer_operations()
+	{
+		if constexpr (ReflectablePointer<T>) {
+			return &pointer_operations_v<T>;
+		} else {
+			return nullptr;
+		}
+	}
+}
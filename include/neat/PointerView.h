@@ -0,0 +1,71 @@
+// Non owning, type erased view over a pointer-like value, see `PointerOperations.h` for the recognised pointers.
+// Lets graph walks and deep copies follow optionals and (smart) pointers without per-type code.
+#pragma once
+#include "neat/Defines.h"
+#include "neat/TemplateTypeId.h"
+#include "neat/Any.h"
+#include "neat/PointerOperations.h"
+
+#include <cassert>
+#include <memory>
+
+
+namespace Neat
+{
+	class PointerView
+	{
+	public:
+		// Construction
+		PointerView() = default;
+		PointerView(AnyPtr pointer, const PointerOperations& operations);
+		REFL_API static PointerView create(AnyPtr pointer); // Returns an invalid view if the type isn't registered or isn't a pointer
+		template<ReflectablePointer T>
+		static PointerView create(T& pointer);
+
+		// Accessors
+		bool is_valid() const { return operations != nullptr; }
+		explicit operator bool() const { return is_valid(); }
+		AnyPtr pointer() const { return pointer_ptr; }
+		PointerKind kind() const { return operations->kind; }
+		bool is_owning() const { return operations->is_owning; }
+		TemplateTypeId pointee_type() const { return pointee_type_id; } // The static type, `get()` returns the dynamic type
+
+		bool has_value() const { return get().value_ptr != nullptr; }
+		AnyPtr get() const { return operations->get(pointer_ptr.value_ptr); } // Empty when there's no value
+
+		// Modifiers
+		void reset() const { operations->reset(pointer_ptr.value_ptr); }
+		bool can_emplace() const { return operations->emplace != nullptr; }
+		AnyPtr emplace() const; // Value initialises a new pointee of the static type
+
+	private:
+		// Data
+		AnyPtr pointer_ptr{};
+		const PointerOperations* operations = nullptr;
+		TemplateTypeId pointee_type_id = c_empty_type_id;
+	};
+}
+
+
+// Implementation
+namespace Neat
+{
+	inline PointerView::PointerView(AnyPtr pointer, const PointerOperations& operations)
+		: pointer_ptr(pointer)
+		, operations(&operations)
+		, pointee_type_id(operations.pointee_type())
+	{
+	}
+
+	template<ReflectablePointer T>
+	PointerView PointerView::create(T& pointer)
+	{
+		return PointerView{ AnyPtr{ std::addressof(pointer), get_id<T>() }, pointer_operations_v<T> };
+	}
+
+	inline AnyPtr PointerView::emplace() const
+	{
+		assert(can_emplace() && "Only owning pointers to default constructible types can emplace.");
+		return operations->emplace(pointer_ptr.value_ptr);
+	}
+}
@@ -5,8 +5,12 @@
 #include "neat/TemplateTypeId.h"
 #include "neat/ReflectPrivateMembers.h"
 #include "neat/Any.h"
+#include "neat/ValueOperations.h"
+#include "neat/ContainerOperations.h"
+#include "neat/PointerOperations.h"
 
 #include <array>
+#include <algorithm>
 #include <variant>
 #include <string>
 #include <string_view>
@@ -17,6 +21,11 @@
 #include <compare>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <optional>
+#include <memory>
+#include <typeinfo>
 
 // Forward Declarations
 namespace Neat
@@ -26,7 +35,10 @@ namespace Neat
 	struct TypeAlias;
 	struct Field;
 	struct Method;
+	struct Constructor;
 	struct TemplateArgument;
+	struct Function;
+	struct Variable;
 }
 
 
@@ -40,37 +52,121 @@ namespace Neat
 	REFL_API std::span<const Type> get_types();
 	REFL_API const Type* get_type(std::string_view type_name);
 	REFL_API const Type* get_type(TemplateTypeId type_id);
+	REFL_API const Type* get_type(const std::type_info& type_info); // Only finds polymorphic types
 	template<typename T> 
 	const Type* get_type() { return get_type(get_id<T>()); }
 
+	// Returns false if another type already has this stable id, which means two qualified names hash to the same id.
+	// The first type keeps the id.
+	REFL_API bool set_stable_id(TemplateTypeId type_id, StableTypeId stable_id);
+	REFL_API const Type* get_type_by_stable_id(StableTypeId stable_id);
+
+	// Hot reload, see `VersionedTypeId`. Stale types stay registered, but versioned lookups of them fail.
+	REFL_API Type& replace_type(Type&&); // Overwrites a registered type and bumps its generation, or adds it
+	REFL_API void invalidate_module(ModuleTag module_tag); // Bumps the generation of every type owned by the module
+	REFL_API VersionedTypeId get_versioned_id(TemplateTypeId type_id); // Empty when the type isn't registered
+	REFL_API bool is_current(VersionedTypeId versioned_id); // False once the type was replaced or its module invalidated
+	REFL_API const Type* get_type(VersionedTypeId versioned_id); // nullptr for stale ids
+
+	// Free functions, static member functions and variables, looked up by their qualified name (e.g. "game::spawn_entity").
+	// Overloads share a qualified name, `get_function` finds the first one added and `get_functions` all of them.
+	REFL_API Function& add_function(Function&&); // Returns the registered function when an equal one was already added
+	REFL_API std::span<const Function> get_functions();
+	REFL_API const Function* get_function(std::string_view qualified_name);
+	REFL_API std::vector<const Function*> get_functions(std::string_view qualified_name);
+
+	REFL_API Variable& add_variable(Variable&&);
+	REFL_API std::span<const Variable> get_variables();
+	REFL_API const Variable* get_variable(std::string_view qualified_name);
+
 
 	// Types
 	// ===========================================================================
 
 	enum class Access : uint8_t { Public, Protected, Private };
 
+	// How a method parameter or return value is passed
+	enum class Passing : uint8_t { Value, LValueReference, ConstLValueReference, RValueReference };
+	template<typename T>
+	constexpr Passing get_passing();
+
+	// Type traits recorded by `Type::create`
+	enum class TypeFlags : uint32_t
+	{
+		None = 0,
+		TriviallyDefaultConstructible = 1 << 0,
+		TriviallyCopyable = 1 << 1,
+		TriviallyDestructible = 1 << 2,
+		TriviallyRelocatable = 1 << 3,
+		StandardLayout = 1 << 4,
+		HasUniqueObjectRepresentations = 1 << 5, // Equal values have equal bytes
+	};
+	constexpr TypeFlags operator|(TypeFlags a, TypeFlags b) { return TypeFlags(uint32_t(a) | uint32_t(b)); }
+	constexpr TypeFlags operator&(TypeFlags a, TypeFlags b) { return TypeFlags(uint32_t(a) & uint32_t(b)); }
+	constexpr bool has_flags(TypeFlags flags, TypeFlags required) { return (flags & required) == required; }
+
+	// Specialize for types which can be moved with memcpy even though they aren't trivially copyable.
+	template<typename T>
+	struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
 	struct Type
 	{
 		// Functions
 		template<typename T>
 		static Type create(std::string_view name, TemplateTypeId id, 
 			std::vector<BaseClass> bases, std::vector<Field> fields, std::vector<Method> methods,
-			std::vector<TypeAlias> member_aliases, std::vector<TemplateArgument> template_arguments);
+			std::vector<TypeAlias> member_aliases, std::vector<TemplateArgument> template_arguments,
+			std::vector<Constructor> constructors = {}); // Copy and move constructors are added when missing
+
+		// Constructs an object in place with the first constructor whose argument types match, or the default constructor when there are no arguments.
+		// Constructors taking rvalue references are only considered when `allow_move` is set, otherwise the arguments are left untouched.
+		// Returns false when no constructor matches.
+		bool construct(AnyPtr uninitialised_object, std::span<const AnyPtr> arguments, bool allow_move = false) const;
+		const Constructor* find_constructor(std::span<const AnyPtr> arguments, bool allow_move = false) const;
+
+		bool has_flags(TypeFlags required) const { return Neat::has_flags(flags, required); }
 
 		using DefaultConstructor = void (*)(AnyPtr uninitialised_object);
 		using Destructor = void (*)(AnyPtr object);
 		DefaultConstructor default_constructor = nullptr;
 		Destructor destructor = nullptr;
 
+		// Bulk operations over `count` contiguous objects, one indirect call per batch.
+		// Trivial types take a memset / memcpy path.
+		using ConstructNFunction = void (*)(AnyPtr uninitialised_objects, size_t count); // Value initialises
+		using DestroyNFunction = void (*)(AnyPtr objects, size_t count); // A no-op for trivially destructible types
+		using CopyNFunction = void (*)(AnyPtr uninitialised_destination, AnyPtr source, size_t count);
+		using CopyAssignNFunction = void (*)(AnyPtr destination, AnyPtr source, size_t count);
+		using MoveNFunction = void (*)(AnyPtr uninitialised_destination, AnyPtr source, size_t count);
+		using RelocateFunction = void (*)(AnyPtr uninitialised_destination, AnyPtr source, size_t count); // Move constructs `count` objects, then destroys the sources
+		ConstructNFunction construct_n = nullptr;
+		DestroyNFunction destroy_n = nullptr;
+		CopyNFunction copy_n = nullptr;
+		CopyAssignNFunction copy_assign_n = nullptr;
+		MoveNFunction move_n = nullptr;
+		RelocateFunction relocate_n = nullptr;
+
+		const ValueOperations* value_operations = nullptr; // Comparison & hashing, see `value_operations_v`
+		const SequenceOperations* sequence_operations = nullptr; // Only set for sequence containers and C arrays, see `SequenceView`
+		const MapOperations* map_operations = nullptr; // Only set for maps, see `MapView`
+		const PointerOperations* pointer_operations = nullptr; // Only set for optionals and (smart) pointers, see `PointerView`
+		const std::type_info* type_info = nullptr; // Only set for polymorphic types, to find the dynamic type of a pointee
+
 		// Data
 		std::string name;
 		TemplateTypeId id;
+		StableTypeId stable_id = c_empty_stable_type_id; // Only set when stable ids are registered
+		ModuleTag module_tag = c_empty_module_tag; // Set by the registering module when it can be reloaded
+		TypeGeneration generation = 0; // Managed by the registry
 		size_t size;
+		size_t alignment;
+		TypeFlags flags = TypeFlags::None;
 		std::vector<BaseClass> bases;
 		std::vector<Field> fields;
 		std::vector<Method> methods;
 		std::vector<TypeAlias> member_aliases;
 		std::vector<TemplateArgument> template_arguments;
+		std::vector<Constructor> constructors;
 
 		// Operators
 		bool operator==(const Type& other) const noexcept;
@@ -79,12 +175,22 @@ namespace Neat
 
 	struct BaseClass
 	{
+		// Functions
+		template<typename TDerived, typename TBase>
+		static BaseClass create(Access access); // Only for accessible bases, the upcast is a `static_cast`
+
 		// Data
 		TemplateTypeId base_id;
 		Access access;
 
+		// Converts a pointer to the derived object into a pointer to its base subobject.
+		// nullptr when the base isn't accessible from the code that registered the type.
+		using UpcastFunction = AnyPtr (*)(AnyPtr derived_object);
+		UpcastFunction upcast = nullptr;
+
 		// Operators
-		auto operator<=>(const BaseClass& other) const noexcept = default;
+		bool operator==(const BaseClass& other) const noexcept;
+		std::strong_ordering operator<=>(const BaseClass& other) const noexcept;
 	};
 
 	struct TypeAlias
@@ -107,16 +213,29 @@ namespace Neat
 		using GetValueFunction = Any (*)(AnyPtr object);
 		using SetValueFunction = void (*)(AnyPtr object, Any value);
 		using GetAddressFunction = AnyPtr (*)(AnyPtr object);
-		GetValueFunction get_value;
-		SetValueFunction set_value;
+		GetValueFunction get_value; // nullptr for fields which can't be copied, e.g. a `std::unique_ptr`
+		SetValueFunction set_value; // nullptr for fields which can't be copy assigned
 		GetAddressFunction get_address;
 
+		// Layout
+		// The offset is only recorded for non polymorphic object types, for those the field can be reached without calling `get_address`.
+		std::optional<size_t> offset;
+		size_t size; // sizeof the field's type
+		TypeFlags type_flags; // Flags of the field's type
+
+		// Non owning access to the field's value, never copies it.
+		AnyRef get_ref(AnyRef object) const;
+		AnyConstRef get_ref(AnyConstRef object) const;
+		template<NotAnyWrapper TObject> requires (!std::is_const_v<TObject>)
+		AnyRef get_ref(TObject& object) const; // Both references convert from a mutable object, this picks `AnyRef`
+
 		// Data
 		TemplateTypeId object_type;
 		TemplateTypeId type;
 		std::string name;
 		std::vector<std::string> attributes; // Unused currently
 		Access access;
+		size_t index = 0; // Position in the object type's `fields`, set by `Type::create`
 
 		// Operators
 		bool operator==(const Field& other) const noexcept;
@@ -130,25 +249,116 @@ namespace Neat
 		static Method create(std::string_view name, Access access);
 
 		using InvokeFunction = Any (*)(AnyPtr object, std::span<Any> arguments);
-		InvokeFunction invoke;
+		InvokeFunction invoke; // Convenience layer, boxes the arguments and the return value in Any's
+		// Doesn't allocate: arguments are read from the pointed to values and the return value is constructed in `return_value`.
+		// `return_value` should point to uninitialised storage of the return type, or be empty to discard the result.
+		// By value parameters get a copy, reference parameters bind to the pointed to values and only rvalue reference parameters may move from them.
+		// nullptr when a by value parameter can't be copied (e.g. a `std::unique_ptr`), use `invoke` instead.
+		using InvokeInPlaceFunction = void (*)(AnyPtr object, std::span<const AnyPtr> arguments, AnyPtr return_value);
+		InvokeInPlaceFunction invoke_in_place;
+		// Returns the object the method returned a reference to, without copying it.
+		// Only set when `return_passing` is a lvalue reference and `invoke_in_place` is set, don't write through references to const.
+		using InvokeRefFunction = AnyRef (*)(AnyPtr object, std::span<const AnyPtr> arguments);
+		InvokeRefFunction invoke_ref;
+		// Invokes the method on every object with the same arguments, validating them once. Arguments are never moved from,
+		// every call gets its own copy for by value and rvalue reference parameters. nullptr when these can't be copied.
+		// `return_values` should point to uninitialised storage for `objects.size()` return values, or be empty to discard the results.
+		using InvokeBatchFunction = void (*)(std::span<const AnyPtr> objects, std::span<const AnyPtr> arguments, AnyPtr return_values);
+		InvokeBatchFunction invoke_batch;
 
 		// Data
 		TemplateTypeId object_type;
-		TemplateTypeId return_type;
+		TemplateTypeId return_type; // Without references and cv qualifiers, see `return_passing`
 		std::string name;
-		std::vector<TemplateTypeId> argument_types;
+		std::vector<TemplateTypeId> argument_types; // Without references and cv qualifiers, like the type ids of the arguments
 		std::vector<std::string> attributes; // Unused currently
 		Access access;
+		std::vector<Passing> argument_passing;
+		Passing return_passing;
 
 		// Operators
 		bool operator==(const Method& other) const noexcept;
 		std::strong_ordering operator<=>(const Method& other) const noexcept;
 	};
 
+	struct Constructor
+	{
+		// Functions
+		template<typename TObject, typename... TArgs>
+		static Constructor create(Access access);
+
+		// Arguments are read from the pointed to values, rvalue reference parameters may move from them.
+		// nullptr when the object can't be constructed from the arguments (e.g. a deleted constructor) or a by value parameter can't be copied.
+		using ConstructFunction = void (*)(AnyPtr uninitialised_object, std::span<const AnyPtr> arguments);
+		ConstructFunction construct;
+
+		bool accepts(std::span<const AnyPtr> arguments, bool allow_move = false) const; // Rvalue reference parameters need `allow_move`
+
+		// Data
+		TemplateTypeId object_type;
+		std::vector<TemplateTypeId> argument_types; // Without references and cv qualifiers, like the type ids of the arguments
+		std::vector<Passing> argument_passing;
+		Access access;
+
+		// Operators
+		bool operator==(const Constructor& other) const noexcept;
+		std::strong_ordering operator<=>(const Constructor& other) const noexcept;
+	};
+
 	struct TemplateArgument
 	{
 		std::variant<TemplateTypeId, Any> type_or_value;
 	};
+
+	// A free function or static member function
+	struct Function
+	{
+		// Functions
+		template<auto PtrToFunction, typename TReturn, typename... TArgs>
+		static Function create(std::string_view qualified_name);
+
+		using InvokeFunction = Any (*)(std::span<Any> arguments);
+		InvokeFunction invoke; // Convenience layer, see `Method::invoke`
+		using InvokeInPlaceFunction = void (*)(std::span<const AnyPtr> arguments, AnyPtr return_value);
+		InvokeInPlaceFunction invoke_in_place; // Doesn't allocate, see `Method::invoke_in_place`, nullptr when it isn't set there
+
+		// Data
+		std::string name; // Qualified name
+		TemplateTypeId return_type; // Without references and cv qualifiers, see `return_passing`
+		std::vector<TemplateTypeId> argument_types; // Without references and cv qualifiers, see `argument_passing`
+		std::vector<Passing> argument_passing;
+		Passing return_passing;
+
+		// Operators
+		bool operator==(const Function& other) const noexcept;
+		std::strong_ordering operator<=>(const Function& other) const noexcept;
+	};
+
+	// A module level variable or static member variable
+	struct Variable
+	{
+		// Functions
+		template<typename TType, TType* PtrToVariable>
+		static Variable create(std::string_view qualified_name);
+
+		using GetValueFunction = Any (*)();
+		using SetValueFunction = void (*)(Any value);
+		GetValueFunction get_value;
+		SetValueFunction set_value; // nullptr for const variables
+
+		AnyRef get_ref() const; // Don't write through the reference of a const variable
+		AnyConstRef get_const_ref() const;
+
+		// Data
+		std::string name; // Qualified name
+		TemplateTypeId type;
+		void* address;
+		bool is_const;
+
+		// Operators
+		bool operator==(const Variable& other) const noexcept;
+		std::strong_ordering operator<=>(const Variable& other) const noexcept;
+	};
 }
 
 
@@ -157,6 +367,43 @@ namespace Neat
 
 namespace Neat
 {
+	template<typename T>
+	constexpr Passing get_passing()
+	{
+		if constexpr (std::is_rvalue_reference_v<T>) {
+			return Passing::RValueReference;
+		} else if constexpr (std::is_lvalue_reference_v<T> && std::is_const_v<std::remove_reference_t<T>>) {
+			return Passing::ConstLValueReference;
+		} else if constexpr (std::is_lvalue_reference_v<T>) {
+			return Passing::LValueReference;
+		} else {
+			return Passing::Value;
+		}
+	}
+
+	namespace Detail
+	{
+		// Passes an argument stored by the caller: by value parameters get a copy, only rvalue reference parameters move from it.
+		template<typename TArg>
+		decltype(auto) pass_argument(const AnyPtr& argument)
+		{
+			using ArgT = std::decay_t<TArg>;
+			ArgT& value = *static_cast<ArgT*>(argument.value_ptr);
+
+			if constexpr (std::is_rvalue_reference_v<TArg>) {
+				return std::move(value);
+			} else if constexpr (std::is_lvalue_reference_v<TArg>) {
+				return static_cast<TArg>(value);
+			} else {
+				return static_cast<const ArgT&>(value);
+			}
+		}
+
+		// `pass_argument` copies by value arguments, so the thunks using it are only created when they can be copied.
+		template<typename... TArgs>
+		inline constexpr bool c_can_pass_arguments = ((std::is_reference_v<TArgs> || std::is_copy_constructible_v<std::decay_t<TArgs>>) && ...);
+	}
+
 	namespace Detail
 	{
 		template<typename T>
@@ -175,12 +422,235 @@ namespace Neat
 			T* object_ = static_cast<T*>(object.value_ptr);
 			object_->~T();
 		}
+
+		template<typename T>
+		void construct_n_erased(AnyPtr uninitialised_objects, size_t count)
+		{
+			assert(uninitialised_objects.type_id == get_id<T>());
+
+			if constexpr (std::is_trivially_default_constructible_v<T>) {
+				// Value initialisation of a trivial type zero initialises it
+				memset(uninitialised_objects.value_ptr, 0, count * sizeof(T));
+			} else {
+				T* objects_ = static_cast<T*>(uninitialised_objects.value_ptr);
+				for (size_t i = 0; i < count; ++i) {
+					new (objects_ + i) T{};
+				}
+			}
+		}
+
+		template<typename T>
+		void destroy_n_erased(AnyPtr objects, size_t count)
+		{
+			assert(objects.type_id == get_id<T>());
+
+			if constexpr (!std::is_trivially_destructible_v<T>) {
+				T* objects_ = static_cast<T*>(objects.value_ptr);
+				for (size_t i = 0; i < count; ++i) {
+					objects_[i].~T();
+				}
+			}
+		}
+
+		template<typename T>
+		void copy_n_erased(AnyPtr uninitialised_destination, AnyPtr source, size_t count)
+		{
+			assert(uninitialised_destination.type_id == get_id<T>());
+			assert(source.type_id == get_id<T>());
+
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				memcpy(uninitialised_destination.value_ptr, source.value_ptr, count * sizeof(T));
+			} else {
+				T* destination_ = static_cast<T*>(uninitialised_destination.value_ptr);
+				const T* source_ = static_cast<const T*>(source.value_ptr);
+				for (size_t i = 0; i < count; ++i) {
+					new (destination_ + i) T(source_[i]);
+				}
+			}
+		}
+
+		template<typename T>
+		void copy_assign_n_erased(AnyPtr destination, AnyPtr source, size_t count)
+		{
+			assert(destination.type_id == get_id<T>());
+			assert(source.type_id == get_id<T>());
+
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				memcpy(destination.value_ptr, source.value_ptr, count * sizeof(T));
+			} else {
+				T* destination_ = static_cast<T*>(destination.value_ptr);
+				const T* source_ = static_cast<const T*>(source.value_ptr);
+				for (size_t i = 0; i < count; ++i) {
+					destination_[i] = source_[i];
+				}
+			}
+		}
+
+		template<typename T>
+		void move_n_erased(AnyPtr uninitialised_destination, AnyPtr source, size_t count)
+		{
+			assert(uninitialised_destination.type_id == get_id<T>());
+			assert(source.type_id == get_id<T>());
+
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				memcpy(uninitialised_destination.value_ptr, source.value_ptr, count * sizeof(T));
+			} else {
+				T* destination_ = static_cast<T*>(uninitialised_destination.value_ptr);
+				T* source_ = static_cast<T*>(source.value_ptr);
+				for (size_t i = 0; i < count; ++i) {
+					new (destination_ + i) T(std::move(source_[i]));
+				}
+			}
+		}
+
+		template<typename T>
+		void relocate_n_erased(AnyPtr uninitialised_destination, AnyPtr source, size_t count)
+		{
+			assert(uninitialised_destination.type_id == get_id<T>());
+			assert(source.type_id == get_id<T>());
+
+			if constexpr (IsTriviallyRelocatable<T>::value) {
+				memcpy(uninitialised_destination.value_ptr, source.value_ptr, count * sizeof(T));
+			} else {
+				T* destination_ = static_cast<T*>(uninitialised_destination.value_ptr);
+				T* source_ = static_cast<T*>(source.value_ptr);
+				for (size_t i = 0; i < count; ++i) {
+					new (destination_ + i) T(std::move(source_[i]));
+					source_[i].~T();
+				}
+			}
+		}
+
+		template<typename T>
+		constexpr TypeFlags get_type_flags()
+		{
+			TypeFlags flags = TypeFlags::None;
+			if (std::is_trivially_default_constructible_v<T>) { flags = flags | TypeFlags::TriviallyDefaultConstructible; }
+			if (std::is_trivially_copyable_v<T>) { flags = flags | TypeFlags::TriviallyCopyable; }
+			if (std::is_trivially_destructible_v<T>) { flags = flags | TypeFlags::TriviallyDestructible; }
+			if (IsTriviallyRelocatable<T>::value) { flags = flags | TypeFlags::TriviallyRelocatable; }
+			if (std::is_standard_layout_v<T>) { flags = flags | TypeFlags::StandardLayout; }
+			if (std::has_unique_object_representations_v<T>) { flags = flags | TypeFlags::HasUniqueObjectRepresentations; }
+			return flags;
+		}
+	}
+
+	namespace Detail
+	{
+		template<typename TObject, typename ...TArgs>
+		void construct_erased(AnyPtr uninitialised_object, std::span<const AnyPtr> arguments)
+		{
+			// Validate object
+			assert(uninitialised_object.type_id == get_id<TObject>());
+
+			// Validate arguments
+			assert(arguments.size() == sizeof...(TArgs));
+			assert(([&]<size_t... I>(std::index_sequence<I...>) {
+				return ((arguments[I].type_id == get_id<std::decay_t<TArgs>>() && arguments[I].value_ptr != nullptr) && ...);
+			}(std::index_sequence_for<TArgs...>{})));
+
+			// Construct in place, reference parameters bind directly to the caller's values and by value parameters copy them
+			[&]<size_t... I>(std::index_sequence<I...>) {
+				new (uninitialised_object.value_ptr) TObject(pass_argument<TArgs>(arguments[I])...);
+			}(std::index_sequence_for<TArgs...>{});
+		}
+
+		template<typename TObject, typename TArg>
+		void add_constructor_if_missing(std::vector<Constructor>& constructors)
+		{
+			if constexpr (std::is_constructible_v<TObject, TArg>) {
+				const bool exists = std::any_of(constructors.begin(), constructors.end(), [](const Constructor& constructor) {
+					return constructor.argument_types.size() == 1 && constructor.argument_types[0] == get_id<TObject>()
+						&& constructor.argument_passing[0] == get_passing<TArg>();
+				});
+
+				if (!exists) {
+					constructors.push_back(Constructor::create<TObject, TArg>(Access::Public));
+				}
+			}
+		}
+	}
+
+	namespace Detail
+	{
+		template<typename TObject, typename ...TArgs>
+		constexpr Constructor::ConstructFunction get_construct()
+		{
+			if constexpr (std::is_constructible_v<TObject, TArgs...> && c_can_pass_arguments<TArgs...>) {
+				return &construct_erased<TObject, TArgs...>;
+			} else {
+				return nullptr;
+			}
+		}
+	}
+
+	template<typename TObject, typename ...TArgs>
+	Constructor Constructor::create(Access access)
+	{
+		return Constructor{
+			.construct = Detail::get_construct<TObject, TArgs...>(),
+			.object_type = get_id<TObject>(),
+			.argument_types = {get_id<std::remove_cvref_t<TArgs>>()...},
+			.argument_passing = {get_passing<TArgs>()...},
+			.access = access
+		};
+	}
+
+	inline bool Constructor::accepts(std::span<const AnyPtr> arguments, bool allow_move) const
+	{
+		if (construct == nullptr) {
+			return false;
+		}
+
+		if (!allow_move && std::find(argument_passing.begin(), argument_passing.end(), Passing::RValueReference) != argument_passing.end()) {
+			return false;
+		}
+
+		return std::equal(argument_types.begin(), argument_types.end(), arguments.begin(), arguments.end(),
+			[](TemplateTypeId argument_type, const AnyPtr& argument) { return argument_type == argument.type_id; });
+	}
+
+	inline const Constructor* Type::find_constructor(std::span<const AnyPtr> arguments, bool allow_move) const
+	{
+		auto it = std::find_if(constructors.begin(), constructors.end(), [arguments, allow_move](const Constructor& constructor) { return constructor.accepts(arguments, allow_move); });
+		return it != constructors.end() ? &*it : nullptr;
+	}
+
+	inline bool Type::construct(AnyPtr uninitialised_object, std::span<const AnyPtr> arguments, bool allow_move) const
+	{
+		assert(uninitialised_object.type_id == id);
+
+		if (const Constructor* constructor = find_constructor(arguments, allow_move)) {
+			constructor->construct(uninitialised_object, arguments);
+			return true;
+		}
+
+		if (arguments.empty() && default_constructor != nullptr) {
+			default_constructor(uninitialised_object);
+			return true;
+		}
+
+		return false;
+	}
+
+	namespace Detail
+	{
+		template<typename T>
+		const std::type_info* get_polymorphic_type_info()
+		{
+			if constexpr (std::is_polymorphic_v<T>) {
+				return &typeid(T);
+			} else {
+				return nullptr;
+			}
+		}
 	}
 
 	template<typename T>
 	Type Type::create(std::string_view name, TemplateTypeId id,
 		std::vector<BaseClass> bases, std::vector<Field> fields, std::vector<Method> methods,
-		std::vector<TypeAlias> member_aliases, std::vector<TemplateArgument> template_arguments)
+		std::vector<TypeAlias> member_aliases, std::vector<TemplateArgument> template_arguments,
+		std::vector<Constructor> constructors)
 	{
 		DefaultConstructor default_constructor = nullptr;
 		if constexpr (std::is_default_constructible_v<T>) {
@@ -192,17 +662,85 @@ namespace Neat
 			destructor = &Detail::destructor_erased<T>;
 		}
 
+		ConstructNFunction construct_n = nullptr;
+		if constexpr (std::is_default_constructible_v<T>) {
+			construct_n = &Detail::construct_n_erased<T>;
+		}
+
+		CopyNFunction copy_n = nullptr;
+		if constexpr (std::is_copy_constructible_v<T>) {
+			copy_n = &Detail::copy_n_erased<T>;
+		}
+
+		CopyAssignNFunction copy_assign_n = nullptr;
+		if constexpr (std::is_copy_assignable_v<T>) {
+			copy_assign_n = &Detail::copy_assign_n_erased<T>;
+		}
+
+		MoveNFunction move_n = nullptr;
+		RelocateFunction relocate_n = nullptr;
+		if constexpr (std::is_move_constructible_v<T>) {
+			move_n = &Detail::move_n_erased<T>;
+			relocate_n = &Detail::relocate_n_erased<T>;
+		}
+
+		for (size_t i = 0; i < fields.size(); ++i) {
+			fields[i].index = i;
+		}
+
+		// Copy constructors go first, so `construct` doesn't move from the caller's value unless asked to.
+		Detail::add_constructor_if_missing<T, const T&>(constructors);
+		Detail::add_constructor_if_missing<T, T&&>(constructors);
+
 		return Type{
 			.default_constructor = default_constructor,
 			.destructor = destructor,
+			.construct_n = construct_n,
+			.destroy_n = &Detail::destroy_n_erased<T>,
+			.copy_n = copy_n,
+			.copy_assign_n = copy_assign_n,
+			.move_n = move_n,
+			.relocate_n = relocate_n,
+			.value_operations = &value_operations_v<T>,
+			.sequence_operations = get_sequence_operations<T>(),
+			.map_operations = get_map_operations<T>(),
+			.pointer_operations = get_pointer_operations<T>(),
+			.type_info = Detail::get_polymorphic_type_info<T>(),
 			.name = std::string{ name },
 			.id = id,
 			.size = sizeof(T),
+			.alignment = alignof(T),
+			.flags = Detail::get_type_flags<T>(),
 			.bases = std::move(bases),
 			.fields = std::move(fields),
 			.methods = std::move(methods),
 			.member_aliases = std::move(member_aliases),
-			.template_arguments = std::move(template_arguments)
+			.template_arguments = std::move(template_arguments),
+			.constructors = std::move(constructors)
+		};
+	}
+
+	namespace Detail
+	{
+		template<typename TDerived, typename TBase>
+		AnyPtr upcast_erased(AnyPtr derived_object)
+		{
+			assert(derived_object.type_id == get_id<TDerived>());
+
+			TBase* base = static_cast<TDerived*>(derived_object.value_ptr);
+			return AnyPtr{ base, get_id<TBase>() };
+		}
+	}
+
+	template<typename TDerived, typename TBase>
+	BaseClass BaseClass::create(Access access)
+	{
+		static_assert(std::is_base_of_v<TBase, TDerived>, "TBase needs to be a base class of TDerived.");
+
+		return BaseClass{
+			.base_id = get_id<TBase>(),
+			.access = access,
+			.upcast = &Detail::upcast_erased<TDerived, TBase>
 		};
 	}
 
@@ -217,6 +755,12 @@ namespace Neat
 			return object_->*PtrToMember;
 		}
 
+		// The number of objects tracked by `track_changes`, see `ChangeTracking.h`. Read inline, so writes don't call into the library while nothing is tracked.
+		REFL_API extern size_t tracked_object_count;
+
+		// Marks the field dirty when the object is tracked.
+		REFL_API void record_field_write(AnyPtr object, const void* field_address, TemplateTypeId field_type);
+
 		template<typename TObject, typename TType, TType TObject::* PtrToMember>
 		void set_field_erased(AnyPtr object, Any value)
 		{
@@ -225,6 +769,9 @@ namespace Neat
 
 			TObject* object_ = static_cast<TObject*>(object.value_ptr);
 			object_->*PtrToMember = value.value<TType>();
+			if (tracked_object_count != 0) {
+				record_field_write(object, std::addressof(object_->*PtrToMember), get_id<TType>());
+			}
 		}
 
 		template<typename TObject, typename TType, TType TObject::* PtrToMember>
@@ -239,18 +786,42 @@ namespace Neat
 		}
 	}
 
+	namespace Detail
+	{
+		template<typename TObject, typename TType, TType TObject::* PtrToMember>
+		std::optional<size_t> get_field_offset()
+		{
+			if constexpr (std::is_polymorphic_v<TObject>) {
+				return std::nullopt;
+			} else {
+				// Like `offsetof`, but it works with a pointer to member. The storage is never read from.
+				alignas(TObject) std::byte storage[sizeof(TObject)];
+				const TObject* object = reinterpret_cast<const TObject*>(storage);
+				return static_cast<size_t>(reinterpret_cast<const std::byte*>(&(object->*PtrToMember)) - storage);
+			}
+		}
+	}
+
 	template<typename TObject, typename TType, TType TObject::* PtrToMember>
 	Field Field::create(std::string_view name, Access access)
 	{
+		GetValueFunction get_value = nullptr;
+		if constexpr (std::is_copy_constructible_v<TType>) {
+			get_value = &Detail::get_field_erased<TObject, TType, PtrToMember>;
+		}
+
 		SetValueFunction set_value = nullptr;
-		if constexpr (std::is_assignable_v<TType&, TType>) {
+		if constexpr (std::is_copy_assignable_v<TType>) {
 			set_value = &Detail::set_field_erased<TObject, TType, PtrToMember>;
 		}
 
 		return Field{
-			.get_value = &Detail::get_field_erased<TObject, TType, PtrToMember>,
+			.get_value = get_value,
 			.set_value = set_value,
 			.get_address = &Detail::get_field_address_erased<TObject, TType, PtrToMember>,
+			.offset = Detail::get_field_offset<TObject, TType, PtrToMember>(),
+			.size = sizeof(TType),
+			.type_flags = Detail::get_type_flags<TType>(),
 			.object_type = get_id<TObject>(),
 			.type = get_id<TType>(),
 			.name = std::string{ name },
@@ -258,6 +829,24 @@ namespace Neat
 		};
 	}
 
+	inline AnyRef Field::get_ref(AnyRef object) const
+	{
+		return get_address(object.to_any_ptr());
+	}
+
+	inline AnyConstRef Field::get_ref(AnyConstRef object) const
+	{
+		// The address getter only computes a member address, so it's safe to hand it a const object.
+		AnyPtr address = get_address(AnyPtr{ const_cast<void*>(object.value_ptr), object.type_id });
+		return AnyConstRef{ address.value_ptr, address.type_id };
+	}
+
+	template<NotAnyWrapper TObject> requires (!std::is_const_v<TObject>)
+	AnyRef Field::get_ref(TObject& object) const
+	{
+		return get_ref(AnyRef{ object });
+	}
+
 	namespace Detail
 	{
 		template<size_t TTemplateArgCount>
@@ -276,6 +865,22 @@ namespace Neat
 			return true;
 		}
 
+		template<size_t TTemplateArgCount>
+		inline bool validate_function_arguments(std::array<TemplateTypeId, TTemplateArgCount> template_arguments, std::span<const AnyPtr> arguments)
+		{
+			if (template_arguments.size() != arguments.size()) {
+				return false;
+			}
+
+			for (size_t i = 0; i < template_arguments.size(); ++i) {
+				if (template_arguments[i] != arguments[i].type_id || arguments[i].value_ptr == nullptr) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+
 		template<auto PtrToMemberFunction, typename TObject, typename TReturn, typename ...TArgs>
 		Any invoke_erased(AnyPtr object, std::span<Any> arguments)
 		{
@@ -286,7 +891,7 @@ namespace Neat
 			assert(validate_function_arguments(std::array<TemplateTypeId, sizeof...(TArgs)>{ get_id<std::decay_t<TArgs>>()... }, arguments));
 			
 			// Invoke method
-			auto unwrap_arguments_and_invoke = []<size_t... I>(TObject* t_object, std::span<Any> arguments, std::index_sequence<I...>)
+			auto unwrap_arguments_and_invoke = []<size_t... I>(TObject* t_object, [[maybe_unused]] std::span<Any> arguments, std::index_sequence<I...>)
 			{
 				return (t_object->*PtrToMemberFunction)((std::forward<TArgs>(arguments[I].value<std::decay_t<TArgs>>()))...);
 			};
@@ -303,6 +908,147 @@ namespace Neat
 				return unwrap_arguments_and_invoke(object_, arguments, std::index_sequence_for<TArgs...>{});
 			}
 		}
+
+		template<auto PtrToMemberFunction, typename TObject, typename TReturn, typename ...TArgs>
+		void invoke_in_place_erased(AnyPtr object, std::span<const AnyPtr> arguments, AnyPtr return_value)
+		{
+			// Validate object
+			assert(object.type_id == get_id<TObject>());
+
+			// Validate arguments
+			assert(validate_function_arguments(std::array<TemplateTypeId, sizeof...(TArgs)>{ get_id<std::decay_t<TArgs>>()... }, arguments));
+
+			// Invoke method, reference parameters bind directly to the caller's values
+			auto unwrap_arguments_and_invoke = []<size_t... I>(TObject* t_object, [[maybe_unused]] std::span<const AnyPtr> arguments, std::index_sequence<I...>) -> decltype(auto)
+			{
+				return (t_object->*PtrToMemberFunction)(pass_argument<TArgs>(arguments[I])...);
+			};
+
+			TObject* object_ = static_cast<TObject*>(object.value_ptr);
+
+			if constexpr (std::is_void_v<TReturn>)
+			{
+				unwrap_arguments_and_invoke(object_, arguments, std::index_sequence_for<TArgs...>{});
+			}
+			else
+			{
+				using ReturnT = std::decay_t<TReturn>;
+
+				if (return_value.value_ptr == nullptr) {
+					unwrap_arguments_and_invoke(object_, arguments, std::index_sequence_for<TArgs...>{});
+					return;
+				}
+
+				assert(return_value.type_id == get_id<ReturnT>());
+				new (return_value.value_ptr) ReturnT(unwrap_arguments_and_invoke(object_, arguments, std::index_sequence_for<TArgs...>{}));
+			}
+		}
+
+		// Every call of a batch shares the caller's arguments, so nothing may move from them.
+		// Rvalue reference parameters get a fresh copy per call instead.
+		template<typename TArg>
+		decltype(auto) pass_batch_argument(const AnyPtr& argument)
+		{
+			if constexpr (std::is_rvalue_reference_v<TArg>) {
+				using ArgT = std::decay_t<TArg>;
+				return ArgT(*static_cast<const ArgT*>(argument.value_ptr));
+			} else {
+				return pass_argument<TArg>(argument);
+			}
+		}
+
+		template<auto PtrToMemberFunction, typename TObject, typename TReturn, typename ...TArgs>
+		void invoke_batch_erased(std::span<const AnyPtr> objects, std::span<const AnyPtr> arguments, AnyPtr return_values)
+		{
+			// Validate objects
+			assert(std::all_of(objects.begin(), objects.end(), [](const AnyPtr& object) { return object.type_id == get_id<TObject>(); }));
+
+			// Validate arguments
+			assert(validate_function_arguments(std::array<TemplateTypeId, sizeof...(TArgs)>{ get_id<std::decay_t<TArgs>>()... }, arguments));
+
+			// Invoke method, the loop lives here so the call can be inlined
+			auto unwrap_arguments_and_invoke = []<size_t... I>(TObject* t_object, [[maybe_unused]] std::span<const AnyPtr> arguments, std::index_sequence<I...>) -> decltype(auto)
+			{
+				return (t_object->*PtrToMemberFunction)(pass_batch_argument<TArgs>(arguments[I])...);
+			};
+
+			if constexpr (std::is_void_v<TReturn>)
+			{
+				for (const AnyPtr& object : objects) {
+					unwrap_arguments_and_invoke(static_cast<TObject*>(object.value_ptr), arguments, std::index_sequence_for<TArgs...>{});
+				}
+			}
+			else
+			{
+				using ReturnT = std::decay_t<TReturn>;
+
+				if (return_values.value_ptr == nullptr) {
+					for (const AnyPtr& object : objects) {
+						unwrap_arguments_and_invoke(static_cast<TObject*>(object.value_ptr), arguments, std::index_sequence_for<TArgs...>{});
+					}
+					return;
+				}
+
+				assert(return_values.type_id == get_id<ReturnT>());
+				ReturnT* results = static_cast<ReturnT*>(return_values.value_ptr);
+				for (size_t i = 0; i < objects.size(); ++i) {
+					new (results + i) ReturnT(unwrap_arguments_and_invoke(static_cast<TObject*>(objects[i].value_ptr), arguments, std::index_sequence_for<TArgs...>{}));
+				}
+			}
+		}
+
+		template<typename... TArgs>
+		inline constexpr bool c_can_pass_batch_arguments = ((std::is_lvalue_reference_v<TArgs> || std::is_copy_constructible_v<std::decay_t<TArgs>>) && ...);
+
+		template<auto PtrToMemberFunction, typename TObject, typename TReturn, typename ...TArgs>
+		AnyRef invoke_ref_erased(AnyPtr object, std::span<const AnyPtr> arguments)
+		{
+			static_assert(std::is_lvalue_reference_v<TReturn>, "Only methods returning a lvalue reference can be invoked by reference.");
+
+			// Validate object
+			assert(object.type_id == get_id<TObject>());
+
+			// Validate arguments
+			assert(validate_function_arguments(std::array<TemplateTypeId, sizeof...(TArgs)>{ get_id<std::decay_t<TArgs>>()... }, arguments));
+
+			auto unwrap_arguments_and_invoke = []<size_t... I>(TObject* t_object, [[maybe_unused]] std::span<const AnyPtr> arguments, std::index_sequence<I...>) -> TReturn
+			{
+				return (t_object->*PtrToMemberFunction)(pass_argument<TArgs>(arguments[I])...);
+			};
+
+			TReturn result = unwrap_arguments_and_invoke(static_cast<TObject*>(object.value_ptr), arguments, std::index_sequence_for<TArgs...>{});
+			return AnyRef{ const_cast<void*>(static_cast<const void*>(std::addressof(result))), get_id<std::remove_cvref_t<TReturn>>() };
+		}
+
+		template<auto PtrToMemberFunction, typename TObject, typename TReturn, typename ...TArgs>
+		constexpr Method::InvokeRefFunction get_invoke_ref()
+		{
+			if constexpr (std::is_lvalue_reference_v<TReturn> && c_can_pass_arguments<TArgs...>) {
+				return &invoke_ref_erased<PtrToMemberFunction, TObject, TReturn, TArgs...>;
+			} else {
+				return nullptr;
+			}
+		}
+
+		template<auto PtrToMemberFunction, typename TObject, typename TReturn, typename ...TArgs>
+		constexpr Method::InvokeInPlaceFunction get_invoke_in_place()
+		{
+			if constexpr (c_can_pass_arguments<TArgs...>) {
+				return &invoke_in_place_erased<PtrToMemberFunction, TObject, TReturn, TArgs...>;
+			} else {
+				return nullptr;
+			}
+		}
+
+		template<auto PtrToMemberFunction, typename TObject, typename TReturn, typename ...TArgs>
+		constexpr Method::InvokeBatchFunction get_invoke_batch()
+		{
+			if constexpr (c_can_pass_batch_arguments<TArgs...>) {
+				return &invoke_batch_erased<PtrToMemberFunction, TObject, TReturn, TArgs...>;
+			} else {
+				return nullptr;
+			}
+		}
 	}
 
 	template<auto PtrToMemberFunction, typename TObject, typename TReturn, typename ...TArgs>
@@ -315,14 +1061,177 @@ namespace Neat
 
 		return Method{
 			.invoke = &Detail::invoke_erased<PtrToMemberFunction, TObject, TReturn, TArgs...>,
+			.invoke_in_place = Detail::get_invoke_in_place<PtrToMemberFunction, TObject, TReturn, TArgs...>(),
+			.invoke_ref = Detail::get_invoke_ref<PtrToMemberFunction, TObject, TReturn, TArgs...>(),
+			.invoke_batch = Detail::get_invoke_batch<PtrToMemberFunction, TObject, TReturn, TArgs...>(),
 			.object_type = get_id<TObject>(),
-			.return_type = get_id<TReturn>(),
+			.return_type = get_id<std::remove_cvref_t<TReturn>>(),
 			.name = std::string{name},
-			.argument_types = {get_id<TArgs>()...},
-			.access = access
+			.argument_types = {get_id<std::remove_cvref_t<TArgs>>()...},
+			.access = access,
+			.argument_passing = {get_passing<TArgs>()...},
+			.return_passing = get_passing<TReturn>()
 		};
 	}
 
+	namespace Detail
+	{
+		template<auto PtrToFunction, typename TReturn, typename ...TArgs>
+		Any invoke_function_erased(std::span<Any> arguments)
+		{
+			// Validate arguments
+			assert(validate_function_arguments(std::array<TemplateTypeId, sizeof...(TArgs)>{ get_id<std::decay_t<TArgs>>()... }, arguments));
+
+			// Invoke function
+			auto unwrap_arguments_and_invoke = []<size_t... I>([[maybe_unused]] std::span<Any> arguments, std::index_sequence<I...>)
+			{
+				return PtrToFunction((std::forward<TArgs>(arguments[I].value<std::decay_t<TArgs>>()))...);
+			};
+
+			if constexpr (std::is_void_v<TReturn>)
+			{
+				unwrap_arguments_and_invoke(arguments, std::index_sequence_for<TArgs...>{});
+				return {};
+			}
+			else
+			{
+				return unwrap_arguments_and_invoke(arguments, std::index_sequence_for<TArgs...>{});
+			}
+		}
+
+		template<auto PtrToFunction, typename TReturn, typename ...TArgs>
+		void invoke_function_in_place_erased(std::span<const AnyPtr> arguments, AnyPtr return_value)
+		{
+			// Validate arguments
+			assert(validate_function_arguments(std::array<TemplateTypeId, sizeof...(TArgs)>{ get_id<std::decay_t<TArgs>>()... }, arguments));
+
+			// Invoke function, reference parameters bind directly to the caller's values
+			auto unwrap_arguments_and_invoke = []<size_t... I>([[maybe_unused]] std::span<const AnyPtr> arguments, std::index_sequence<I...>) -> decltype(auto)
+			{
+				return PtrToFunction(pass_argument<TArgs>(arguments[I])...);
+			};
+
+			if constexpr (std::is_void_v<TReturn>)
+			{
+				unwrap_arguments_and_invoke(arguments, std::index_sequence_for<TArgs...>{});
+			}
+			else
+			{
+				using ReturnT = std::decay_t<TReturn>;
+
+				if (return_value.value_ptr == nullptr) {
+					unwrap_arguments_and_invoke(arguments, std::index_sequence_for<TArgs...>{});
+					return;
+				}
+
+				assert(return_value.type_id == get_id<ReturnT>());
+				new (return_value.value_ptr) ReturnT(unwrap_arguments_and_invoke(arguments, std::index_sequence_for<TArgs...>{}));
+			}
+		}
+
+		template<auto PtrToFunction, typename TReturn, typename ...TArgs>
+		constexpr Function::InvokeInPlaceFunction get_invoke_function_in_place()
+		{
+			if constexpr (c_can_pass_arguments<TArgs...>) {
+				return &invoke_function_in_place_erased<PtrToFunction, TReturn, TArgs...>;
+			} else {
+				return nullptr;
+			}
+		}
+
+		template<typename TType, TType* PtrToVariable>
+		Any get_variable_erased()
+		{
+			return *PtrToVariable;
+		}
+
+		template<typename TType, TType* PtrToVariable>
+		void set_variable_erased(Any value)
+		{
+			*PtrToVariable = value.value<TType>();
+		}
+	}
+
+	template<auto PtrToFunction, typename TReturn, typename ...TArgs>
+	Function Function::create(std::string_view qualified_name)
+	{
+		static_assert(std::is_same_v<decltype(PtrToFunction), TReturn (*)(TArgs...)>
+			|| std::is_same_v<decltype(PtrToFunction), TReturn (*)(TArgs...) noexcept>,
+			"PtrToFunction needs to be a value of type `TReturn (*)(TArgs...)`.");
+
+		return Function{
+			.invoke = &Detail::invoke_function_erased<PtrToFunction, TReturn, TArgs...>,
+			.invoke_in_place = Detail::get_invoke_function_in_place<PtrToFunction, TReturn, TArgs...>(),
+			.name = std::string{ qualified_name },
+			.return_type = get_id<std::remove_cvref_t<TReturn>>(),
+			.argument_types = {get_id<std::remove_cvref_t<TArgs>>()...},
+			.argument_passing = {get_passing<TArgs>()...},
+			.return_passing = get_passing<TReturn>()
+		};
+	}
+
+	template<typename TType, TType* PtrToVariable>
+	Variable Variable::create(std::string_view qualified_name)
+	{
+		using CleanT = std::remove_cv_t<TType>;
+
+		SetValueFunction set_value = nullptr;
+		if constexpr (!std::is_const_v<TType>) {
+			set_value = &Detail::set_variable_erased<TType, PtrToVariable>;
+		}
+
+		return Variable{
+			.get_value = &Detail::get_variable_erased<TType, PtrToVariable>,
+			.set_value = set_value,
+			.name = std::string{ qualified_name },
+			.type = get_id<CleanT>(),
+			.address = const_cast<CleanT*>(PtrToVariable),
+			.is_const = std::is_const_v<TType>
+		};
+	}
+
+	inline AnyRef Variable::get_ref() const
+	{
+		return AnyRef{ address, type };
+	}
+
+	inline AnyConstRef Variable::get_const_ref() const
+	{
+		return AnyConstRef{ address, type };
+	}
+
+	inline bool Function::operator==(const Function& other) const noexcept
+	{
+		return (*this <=> other) == std::strong_ordering::equal;
+	}
+
+	inline std::strong_ordering Function::operator<=>(const Function& other) const noexcept
+	{
+		std::strong_ordering order = (name <=> other.name);
+		if (order != 0) { return order; }
+		order = (return_type <=> other.return_type);
+		if (order != 0) { return order; }
+		order = (return_passing <=> other.return_passing);
+		if (order != 0) { return order; }
+		order = (argument_types <=> other.argument_types);
+		if (order != 0) { return order; }
+
+		return argument_passing <=> other.argument_passing;
+	}
+
+	inline bool Variable::operator==(const Variable& other) const noexcept
+	{
+		return (*this <=> other) == std::strong_ordering::equal;
+	}
+
+	inline std::strong_ordering Variable::operator<=>(const Variable& other) const noexcept
+	{
+		std::strong_ordering order = (name <=> other.name);
+		if (order != 0) { return order; }
+
+		return type <=> other.type;
+	}
+
 	inline bool Type::operator==(const Type& other) const noexcept
 	{
 		return (*this <=> other) == std::strong_ordering::equal;
@@ -333,6 +1242,22 @@ namespace Neat
 		return id <=> other.id;
 	}
 
+	inline bool BaseClass::operator==(const BaseClass& other) const noexcept
+	{
+		return (*this <=> other) == std::strong_ordering::equal;
+	}
+
+	inline std::strong_ordering BaseClass::operator<=>(const BaseClass& other) const noexcept
+	{
+		std::strong_ordering order;
+
+		order = (base_id <=> other.base_id);
+		if (order != 0) { return order; }
+		order = (access <=> other.access);
+
+		return order;
+	}
+
 	inline bool Field::operator==(const Field& other) const noexcept
 	{
 		return (*this <=> other) == std::strong_ordering::equal;
@@ -364,10 +1289,29 @@ namespace Neat
 		if (order != 0) { return order; }
 		order = (argument_types <=> other.argument_types);
 		if (order != 0) { return order; }
+		order = (return_passing <=> other.return_passing);
+		if (order != 0) { return order; }
+		order = (argument_passing <=> other.argument_passing);
+		if (order != 0) { return order; }
 		order = (name <=> other.name);
 
 		return order;
 	}
+
+	inline bool Constructor::operator==(const Constructor& other) const noexcept
+	{
+		return (*this <=> other) == std::strong_ordering::equal;
+	}
+
+	inline std::strong_ordering Constructor::operator<=>(const Constructor& other) const noexcept
+	{
+		std::strong_ordering order = (object_type <=> other.object_type);
+		if (order != 0) { return order; }
+		order = (argument_types <=> other.argument_types);
+		if (order != 0) { return order; }
+
+		return argument_passing <=> other.argument_passing;
+	}
 }
 
 namespace Neat::HashUtils
@@ -3,7 +3,12 @@
 #pragma once
 #include "neat/Defines.h"
 
+#include <atomic>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <string_view>
+#include <type_traits>
 
 
 namespace Neat
@@ -12,15 +17,64 @@ namespace Neat
 	using TemplateTypeId = uint32_t;
 
 	inline constexpr TemplateTypeId c_empty_type_id = 0;
+	inline constexpr TemplateTypeId c_first_generated_type_id = 256; // Ids below this are reserved for `FixedTypeId`
 
 	// Automatic type id generation
 	REFL_API TemplateTypeId generate_new_type_id();
 
+	namespace Detail
+	{
+		// Constant initialised, so reading it doesn't need a static initialisation guard.
+		template<typename T>
+		inline constinit TemplateTypeId generated_type_id = c_empty_type_id;
+
+		REFL_API TemplateTypeId assign_type_id(TemplateTypeId& id_slot);
+	}
+
 	template<typename T>
 	TemplateTypeId get_id()
 	{
-		static const TemplateTypeId id = generate_new_type_id();
-		return id;
+		const TemplateTypeId id = std::atomic_ref<TemplateTypeId>{ Detail::generated_type_id<T> }.load(std::memory_order_relaxed);
+		if (id != c_empty_type_id) [[likely]] {
+			return id;
+		}
+
+		return Detail::assign_type_id(Detail::generated_type_id<T>);
+	}
+
+	// Reserved type ids, known at compile time. Used for the fundamental types.
+	template<typename T>
+	struct FixedTypeId {};
+
+	template<> struct FixedTypeId<void> : std::integral_constant<TemplateTypeId, 1> {};
+	template<> struct FixedTypeId<std::nullptr_t> : std::integral_constant<TemplateTypeId, 2> {};
+	template<> struct FixedTypeId<bool> : std::integral_constant<TemplateTypeId, 3> {};
+	template<> struct FixedTypeId<char> : std::integral_constant<TemplateTypeId, 4> {};
+	template<> struct FixedTypeId<signed char> : std::integral_constant<TemplateTypeId, 5> {};
+	template<> struct FixedTypeId<unsigned char> : std::integral_constant<TemplateTypeId, 6> {};
+	template<> struct FixedTypeId<wchar_t> : std::integral_constant<TemplateTypeId, 7> {};
+	template<> struct FixedTypeId<char8_t> : std::integral_constant<TemplateTypeId, 8> {};
+	template<> struct FixedTypeId<char16_t> : std::integral_constant<TemplateTypeId, 9> {};
+	template<> struct FixedTypeId<char32_t> : std::integral_constant<TemplateTypeId, 10> {};
+	template<> struct FixedTypeId<short> : std::integral_constant<TemplateTypeId, 11> {};
+	template<> struct FixedTypeId<unsigned short> : std::integral_constant<TemplateTypeId, 12> {};
+	template<> struct FixedTypeId<int> : std::integral_constant<TemplateTypeId, 13> {};
+	template<> struct FixedTypeId<unsigned int> : std::integral_constant<TemplateTypeId, 14> {};
+	template<> struct FixedTypeId<long> : std::integral_constant<TemplateTypeId, 15> {};
+	template<> struct FixedTypeId<unsigned long> : std::integral_constant<TemplateTypeId, 16> {};
+	template<> struct FixedTypeId<long long> : std::integral_constant<TemplateTypeId, 17> {};
+	template<> struct FixedTypeId<unsigned long long> : std::integral_constant<TemplateTypeId, 18> {};
+	template<> struct FixedTypeId<float> : std::integral_constant<TemplateTypeId, 19> {};
+	template<> struct FixedTypeId<double> : std::integral_constant<TemplateTypeId, 20> {};
+	template<> struct FixedTypeId<long double> : std::integral_constant<TemplateTypeId, 21> {};
+
+	template<typename T>
+	concept FixedTemplateTypeId = requires { { FixedTypeId<T>::value } -> std::convertible_to<TemplateTypeId>; };
+
+	template<FixedTemplateTypeId T>
+	constexpr TemplateTypeId get_id()
+	{
+		return FixedTypeId<T>::value;
 	}
 
 	// Manual type id override
@@ -32,4 +86,52 @@ namespace Neat
 	{
 		return T::ManualId::value;
 	}
+
+	// Versioned type ids, for caches which have to survive a plugin reload.
+	// Layout: | module tag (16 bits) | generation (16 bits) | index (32 bits) |
+	// The index is the plain TemplateTypeId, so dense tables keep indexing by the low bits.
+	// The registry bumps a type's generation when it's replaced or its module is invalidated, see `is_current()`.
+	using ModuleTag = uint16_t;
+	using TypeGeneration = uint16_t; // Wraps around after 65536 reloads of the same type
+
+	inline constexpr ModuleTag c_empty_module_tag = 0; // Types which aren't owned by a reloadable module
+
+	struct VersionedTypeId
+	{
+		// Functions
+		static constexpr VersionedTypeId create(TemplateTypeId index, TypeGeneration generation, ModuleTag module_tag)
+		{
+			return VersionedTypeId{ uint64_t(index) | (uint64_t(generation) << 32) | (uint64_t(module_tag) << 48) };
+		}
+
+		constexpr TemplateTypeId index() const { return TemplateTypeId(value); }
+		constexpr TypeGeneration generation() const { return TypeGeneration(value >> 32); }
+		constexpr ModuleTag module_tag() const { return ModuleTag(value >> 48); }
+		constexpr bool is_empty() const { return index() == c_empty_type_id; }
+
+		// Data
+		uint64_t value = 0;
+
+		// Operators
+		constexpr bool operator==(const VersionedTypeId& other) const = default;
+	};
+
+	// Stable type ids, the same in every run, build and process. Derived from the fully qualified type name.
+	// Opt-in, the code generator registers them when run with `--stable-ids`, see `set_stable_id()`.
+	using StableTypeId = uint64_t;
+
+	inline constexpr StableTypeId c_empty_stable_type_id = 0;
+
+	constexpr StableTypeId make_stable_type_id(std::string_view qualified_name)
+	{
+		// 64 bit FNV-1a
+		StableTypeId hash = 14695981039346656037ull;
+		for (char c : qualified_name) {
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ull;
+		}
+
+		// Reserve id 0 for invalid id's.
+		return hash != c_empty_stable_type_id ? hash : 1;
+	}
 }
@@ -0,0 +1,129 @@
+// Type erased comparison and hashing functions, instantiated once per type.
+// Used by Any and Type to compare or hash values without knowing their type at compile time.
+#pragma once
+#include "neat/Defines.h"
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+
+namespace Neat
+{
+	struct ValueOperations
+	{
+		using EqualFunction = bool (*)(const void* a, const void* b);
+		using CompareFunction = std::partial_ordering (*)(const void* a, const void* b);
+		using HashFunction = size_t (*)(const void* value);
+
+		// Functions, nullptr when the type doesn't support the operation.
+		EqualFunction equal = nullptr;
+		CompareFunction compare = nullptr;
+		HashFunction hash = nullptr;
+
+		// Data
+		size_t size = 0;
+		bool bitwise_comparable = false; // Equal values have equal bytes, so `memcmp` and hashing the bytes is valid.
+	};
+
+	REFL_API size_t hash_bytes(const void* data, size_t size);
+}
+
+
+// Implementation
+namespace Neat
+{
+	namespace Detail
+	{
+		template<typename T>
+		struct IsPair : std::false_type {};
+		template<typename T1, typename T2>
+		struct IsPair<std::pair<T1, T2>> : std::true_type {};
+
+		template<typename T>
+		concept ElementRange = std::ranges::range<T> && !std::is_same_v<std::ranges::range_value_t<T>, T>;
+
+		// Standard containers declare their comparison operators unconstrained, so also check the elements.
+		// Otherwise `std::vector<NotComparable>` would satisfy the concept but fail to instantiate.
+		template<typename T>
+		constexpr bool is_equality_comparable()
+		{
+			if constexpr (!std::equality_comparable<T>) {
+				return false;
+			} else if constexpr (IsPair<T>::value) {
+				return is_equality_comparable<std::remove_cv_t<typename T::first_type>>()
+					&& is_equality_comparable<std::remove_cv_t<typename T::second_type>>();
+			} else if constexpr (ElementRange<T>) {
+				return is_equality_comparable<std::ranges::range_value_t<T>>();
+			} else {
+				return true;
+			}
+		}
+
+		template<typename T>
+		constexpr bool is_three_way_comparable()
+		{
+			if constexpr (!std::three_way_comparable<T, std::partial_ordering>) {
+				return false;
+			} else if constexpr (IsPair<T>::value) {
+				return is_three_way_comparable<std::remove_cv_t<typename T::first_type>>()
+					&& is_three_way_comparable<std::remove_cv_t<typename T::second_type>>();
+			} else if constexpr (ElementRange<T>) {
+				return is_three_way_comparable<std::ranges::range_value_t<T>>();
+			} else {
+				return true;
+			}
+		}
+
+		template<typename T>
+		concept Hashable = requires(const T& value) { { std::hash<T>{}(value) } -> std::convertible_to<size_t>; };
+
+		template<typename T>
+		bool equal_erased(const void* a, const void* b)
+		{
+			return *static_cast<const T*>(a) == *static_cast<const T*>(b);
+		}
+
+		template<typename T>
+		std::partial_ordering compare_erased(const void* a, const void* b)
+		{
+			return *static_cast<const T*>(a) <=> *static_cast<const T*>(b);
+		}
+
+		template<typename T>
+		size_t hash_erased(const void* value)
+		{
+			return std::hash<T>{}(*static_cast<const T*>(value));
+		}
+
+		template<typename T>
+		constexpr ValueOperations create_value_operations()
+		{
+			ValueOperations operations{};
+
+			if constexpr (is_equality_comparable<T>()) {
+				operations.equal = &equal_erased<T>;
+			}
+			if constexpr (is_three_way_comparable<T>()) {
+				operations.compare = &compare_erased<T>;
+			}
+			if constexpr (Hashable<T>) {
+				operations.hash = &hash_erased<T>;
+			}
+
+			operations.size = sizeof(T);
+			// A user defined operator== might not compare all bytes, only take the bitwise path for scalars or types without one.
+			operations.bitwise_comparable = std::has_unique_object_representations_v<T>
+				&& (std::is_scalar_v<T> || !std::equality_comparable<T>);
+
+			return operations;
+		}
+	}
+
+	template<typename T>
+	inline constexpr ValueOperations value_operations_v = Detail::create_value_operations<T>();
+}
@@ -2,6 +2,7 @@
 
 #include <type_traits>
 #include <cassert>
+#include <cstring>
 
 
 namespace Neat
@@ -16,6 +17,7 @@ namespace Neat
 		}
 
 		// Assign other storage
+		value_operations = other.value_operations;
 		template_type_id = other.template_type_id;
 		storage_mode = other.storage_mode;
 	}
@@ -30,10 +32,12 @@ namespace Neat
 		}
 
 		// Assign other storage
+		value_operations = other.value_operations;
 		template_type_id = other.template_type_id;
 		storage_mode = other.storage_mode;
 
 		// Clear other
+		other.value_operations = nullptr;
 		other.template_type_id = c_empty_type_id;
 		other.storage_mode = StorageMode::Empty;
 	}
@@ -99,6 +103,84 @@ namespace Neat
 		return AnyPtr{ object_pointer(), template_type_id };
 	}
 
+	AnyRef Any::to_any_ref()
+	{
+		if (!has_value()) {
+			return AnyRef{};
+		}
+
+		return AnyRef{ object_pointer(), template_type_id };
+	}
+
+	AnyConstRef Any::to_any_ref() const
+	{
+		if (!has_value()) {
+			return AnyConstRef{};
+		}
+
+		return AnyConstRef{ object_pointer(), template_type_id };
+	}
+
+	bool Any::operator==(const Any& other) const
+	{
+		if (template_type_id != other.template_type_id) {
+			return false;
+		}
+		if (!has_value()) {
+			return true;
+		}
+
+		const void* a = object_pointer();
+		const void* b = other.object_pointer();
+
+		if (value_operations->bitwise_comparable) {
+			return memcmp(a, b, value_operations->size) == 0;
+		}
+		if (value_operations->equal) {
+			return value_operations->equal(a, b);
+		}
+
+		return a == b;
+	}
+
+	std::partial_ordering Any::operator<=>(const Any& other) const
+	{
+		if (template_type_id != other.template_type_id) {
+			return template_type_id <=> other.template_type_id;
+		}
+		if (!has_value()) {
+			return std::partial_ordering::equivalent;
+		}
+
+		const void* a = object_pointer();
+		const void* b = other.object_pointer();
+
+		if (value_operations->compare) {
+			return value_operations->compare(a, b);
+		}
+
+		return (*this == other) ? std::partial_ordering::equivalent : std::partial_ordering::unordered;
+	}
+
+	size_t Any::hash() const
+	{
+		if (!has_value()) {
+			return 0;
+		}
+
+		const void* value = object_pointer();
+
+		if (value_operations->bitwise_comparable) {
+			return hash_bytes(value, value_operations->size);
+		}
+		if (value_operations->hash) {
+			return value_operations->hash(value);
+		}
+
+		// Only equal to itself, hashing the type keeps the hash consistent with operator==
+		return std::hash<TemplateTypeId>{}(template_type_id);
+	}
+
 	void* Any::object_pointer()
 	{
 		switch (storage_mode) {
@@ -110,4 +192,9 @@ namespace Neat
 		assert(false && "Unexpected AnyStorageType flag.");
 		return nullptr;
 	}
+
+	const void* Any::object_pointer() const
+	{
+		return const_cast<Any*>(this)->object_pointer();
+	}
 }
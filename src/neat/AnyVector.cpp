@@ -0,0 +1,198 @@
+#include "neat/AnyVector.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <new>
+
+
+namespace Neat
+{
+	namespace
+	{
+		std::byte* allocate_buffer(size_t size_in_bytes, size_t alignment)
+		{
+			return static_cast<std::byte*>(::operator new(size_in_bytes, std::align_val_t{ alignment }));
+		}
+
+		void free_buffer(std::byte* buffer, size_t alignment)
+		{
+			::operator delete(buffer, std::align_val_t{ alignment });
+		}
+
+		const Type& get_registered_type(TemplateTypeId type_id)
+		{
+			const Type* type = get_type(type_id);
+			assert(type != nullptr && "AnyVector can only hold registered types.");
+			return *type;
+		}
+	}
+
+	AnyVector::AnyVector(TemplateTypeId type_id)
+		: AnyVector(get_registered_type(type_id))
+	{
+	}
+
+	AnyVector::AnyVector(const Type& type)
+		: element_type_id(type.id)
+		, element_size(type.size)
+		, element_alignment(type.alignment)
+		, construct_n(type.construct_n)
+		, destroy_n(type.destroy_n)
+		, copy_n(type.copy_n)
+		, relocate_n(type.relocate_n)
+	{
+		assert(element_size > 0 && "AnyVector can't hold values of type void.");
+	}
+
+	AnyVector::AnyVector(const AnyVector& other)
+		: element_type_id(other.element_type_id)
+		, element_size(other.element_size)
+		, element_alignment(other.element_alignment)
+		, construct_n(other.construct_n)
+		, destroy_n(other.destroy_n)
+		, copy_n(other.copy_n)
+		, relocate_n(other.relocate_n)
+	{
+		if (other.empty()) {
+			return;
+		}
+
+		assert(copy_n != nullptr && "Element type isn't copy constructible.");
+		reserve(other.element_count);
+		copy_n(AnyPtr{ buffer, element_type_id }, AnyPtr{ other.buffer, element_type_id }, other.element_count);
+		element_count = other.element_count;
+	}
+
+	AnyVector::AnyVector(AnyVector&& other) noexcept
+		: buffer(std::exchange(other.buffer, nullptr))
+		, element_count(std::exchange(other.element_count, 0))
+		, element_capacity(std::exchange(other.element_capacity, 0))
+		, element_type_id(other.element_type_id)
+		, element_size(other.element_size)
+		, element_alignment(other.element_alignment)
+		, construct_n(other.construct_n)
+		, destroy_n(other.destroy_n)
+		, copy_n(other.copy_n)
+		, relocate_n(other.relocate_n)
+	{
+	}
+
+	AnyVector& AnyVector::operator=(const AnyVector& other)
+	{
+		// Self assignment check
+		if (&other == this) {
+			return *this;
+		}
+
+		// Destroy this
+		this->~AnyVector();
+
+		// Assign other
+		new (this) AnyVector{ other };
+
+		return *this;
+	}
+
+	AnyVector& AnyVector::operator=(AnyVector&& other) noexcept
+	{
+		// Self assignment check
+		if (&other == this) {
+			return *this;
+		}
+
+		// Destroy this
+		this->~AnyVector();
+
+		// Move assign other
+		new (this) AnyVector{ std::move(other) };
+
+		return *this;
+	}
+
+	AnyVector::~AnyVector()
+	{
+		clear();
+
+		if (buffer) {
+			free_buffer(buffer, element_alignment);
+			buffer = nullptr;
+		}
+	}
+
+	void AnyVector::reserve(size_t new_capacity)
+	{
+		if (new_capacity <= element_capacity) {
+			return;
+		}
+
+		adopt_buffer(allocate_buffer(new_capacity * element_size, element_alignment), new_capacity);
+	}
+
+	void AnyVector::resize(size_t new_size)
+	{
+		if (new_size < element_count) {
+			destroy_n(AnyPtr{ element_pointer(new_size), element_type_id }, element_count - new_size);
+		} else if (new_size > element_count) {
+			assert(construct_n != nullptr && "Element type isn't default constructible.");
+			reserve(new_size);
+			construct_n(AnyPtr{ element_pointer(element_count), element_type_id }, new_size - element_count);
+		}
+
+		element_count = new_size;
+	}
+
+	AnyRef AnyVector::emplace_back()
+	{
+		assert(construct_n != nullptr && "Element type isn't default constructible.");
+
+		construct_at_end([this](void* slot) { construct_n(AnyPtr{ slot, element_type_id }, 1); });
+		return back();
+	}
+
+	void AnyVector::push_back(AnyConstRef value)
+	{
+		assert(value.type_id == element_type_id);
+		assert(copy_n != nullptr && "Element type isn't copy constructible.");
+
+		construct_at_end([this, value](void* slot) { copy_n(AnyPtr{ slot, element_type_id }, AnyPtr{ const_cast<void*>(value.value_ptr), element_type_id }, 1); });
+	}
+
+	void AnyVector::pop_back()
+	{
+		assert(!empty());
+
+		--element_count;
+		destroy_n(AnyPtr{ element_pointer(element_count), element_type_id }, 1);
+	}
+
+	void AnyVector::clear()
+	{
+		if (element_count > 0) {
+			destroy_n(AnyPtr{ buffer, element_type_id }, element_count);
+		}
+
+		element_count = 0;
+	}
+
+	std::byte* AnyVector::allocate_grown_buffer(size_t& new_capacity) const
+	{
+		new_capacity = std::max(element_count + 1, element_capacity * 2);
+		return allocate_buffer(new_capacity * element_size, element_alignment);
+	}
+
+	void AnyVector::adopt_buffer(std::byte* new_buffer, size_t new_capacity)
+	{
+		if (element_count > 0) {
+			assert(relocate_n != nullptr && "Element type isn't move constructible, can't grow the AnyVector.");
+			relocate_n(AnyPtr{ new_buffer, element_type_id }, AnyPtr{ buffer, element_type_id }, element_count);
+		}
+
+		if (buffer) {
+			free_buffer(buffer, element_alignment);
+		}
+
+		buffer = new_buffer;
+		element_capacity = new_capacity;
+	}
+}
@@ -0,0 +1,97 @@
+#include "neat/ChangeTracking.h"
+
+#include <unordered_map>
+#include <utility>
+
+
+namespace Neat
+{
+	namespace
+	{
+		struct TrackedObject
+		{
+			TemplateTypeId type_id;
+			DirtyFields dirty_fields;
+		};
+
+		std::unordered_map<const void*, TrackedObject> tracked_objects;
+
+		TrackedObject* find_tracked(AnyPtr object)
+		{
+			// Most programs track nothing, skip the lookup then.
+			if (tracked_objects.empty()) {
+				return nullptr;
+			}
+
+			// A base class subobject can share the address of the tracked object, it isn't tracked itself.
+			auto it = tracked_objects.find(object.value_ptr);
+			if (it == tracked_objects.end() || it->second.type_id != object.type_id) {
+				return nullptr;
+			}
+
+			return &it->second;
+		}
+	}
+
+	namespace Detail
+	{
+		size_t tracked_object_count = 0;
+	}
+
+	void track_changes(AnyPtr object)
+	{
+		tracked_objects.try_emplace(object.value_ptr, TrackedObject{ object.type_id, {} });
+		Detail::tracked_object_count = tracked_objects.size();
+	}
+
+	void untrack_changes(AnyPtr object)
+	{
+		tracked_objects.erase(object.value_ptr);
+		Detail::tracked_object_count = tracked_objects.size();
+	}
+
+	bool is_tracked(AnyPtr object)
+	{
+		return find_tracked(object) != nullptr;
+	}
+
+	void mark_dirty(AnyPtr object, size_t field_index)
+	{
+		if (TrackedObject* tracked = find_tracked(object)) {
+			tracked->dirty_fields.set(field_index);
+		}
+	}
+
+	namespace Detail
+	{
+		void record_field_write(AnyPtr object, const void* field_address, TemplateTypeId field_type)
+		{
+			TrackedObject* tracked = find_tracked(object);
+			if (tracked == nullptr) {
+				return;
+			}
+
+			// The setter doesn't know the field's index, find the field it wrote to.
+			const Type* type = get_type(object.type_id);
+			if (type == nullptr) {
+				return;
+			}
+			for (const Field& field : type->fields) {
+				if (field.type == field_type && field.get_address(object).value_ptr == field_address) {
+					tracked->dirty_fields.set(field.index);
+					return;
+				}
+			}
+		}
+	}
+
+	DirtyFields consume_dirty(AnyPtr object)
+	{
+		TrackedObject* tracked = find_tracked(object);
+		if (tracked == nullptr) {
+			return DirtyFields{};
+		}
+
+		return std::exchange(tracked->dirty_fields, DirtyFields{});
+	}
+}
@@ -0,0 +1,377 @@
+#include "neat/Clone.h"
+#include "neat/PointerOperations.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <unordered_map>
+
+
+namespace Neat
+{
+	CloneArena::CloneArena(size_t block_size)
+		: block_size(block_size)
+	{
+	}
+
+	CloneArena::~CloneArena()
+	{
+		reset();
+	}
+
+	void* CloneArena::allocate(size_t size, size_t alignment)
+	{
+		void* position = block_position;
+		if (std::align(alignment, size, position, block_space) == nullptr) {
+			// Start a new block, oversized allocations get a block of their own.
+			const size_t new_block_size = std::max(block_size, size + alignment);
+			blocks.push_back(std::make_unique<std::byte[]>(new_block_size));
+			position = blocks.back().get();
+			block_space = new_block_size;
+			std::align(alignment, size, position, block_space);
+		}
+
+		block_position = static_cast<std::byte*>(position) + size;
+		block_space -= size;
+		allocated_size += size;
+		return position;
+	}
+
+	void CloneArena::add_destructor(AnyPtr object, Type::Destructor destructor)
+	{
+		destructors.emplace_back(object, destructor);
+	}
+
+	void CloneArena::reset()
+	{
+		for (auto it = destructors.rbegin(); it != destructors.rend(); ++it) {
+			it->second(it->first);
+		}
+
+		destructors.clear();
+		blocks.clear();
+		block_position = nullptr;
+		block_space = 0;
+		allocated_size = 0;
+	}
+
+	namespace
+	{
+		// How a member of an already constructed object is cloned
+		struct MemberStep
+		{
+			enum class Kind : uint8_t
+			{
+				Bytes, // memcpy over [offset, offset + size)
+				Member, // Clone the member at `offset`
+				IndirectMember, // Clone the member returned by `get_address`
+				Base, // Clone the members of the base returned by `upcast`
+			};
+
+			Kind kind;
+			size_t offset = 0;
+			size_t size = 0;
+			TemplateTypeId type_id = c_empty_type_id; // The member or base type
+			Field::GetAddressFunction get_address = nullptr;
+			BaseClass::UpcastFunction upcast = nullptr;
+		};
+
+		// How an object is cloned into uninitialised storage
+		enum class CopyKind : uint8_t
+		{
+			None, // Can't be cloned
+			Bytes, // A single memcpy
+			CopyConstruct,
+			Members, // Default construct, then clone the members
+			OwningPointer, // Default construct, emplace a pointee and clone into it
+			RawPointer, // Copy the pointer, or clone the pointee into the arena
+		};
+
+		struct CopyPlan
+		{
+			VersionedTypeId version;
+			CopyKind kind = CopyKind::None;
+			std::vector<MemberStep> member_steps; // Also used when the type is a base class
+			size_t size = 0;
+			size_t alignment = 1;
+			Type::DefaultConstructor default_constructor = nullptr;
+			Type::Destructor destructor = nullptr;
+			Type::CopyNFunction copy_n = nullptr;
+			const PointerOperations* pointer = nullptr;
+		};
+
+		bool is_raw_pointer(const Type& type)
+		{
+			return type.pointer_operations != nullptr && type.pointer_operations->kind == PointerKind::Raw;
+		}
+
+		// Raw pointers need to be followed when cloning into an arena, so types containing them
+		// can't be copied as bytes or with their copy constructor.
+		bool contains_raw_pointer(TemplateTypeId type_id)
+		{
+			const Type* type = get_type(type_id);
+			if (type == nullptr) {
+				return false;
+			}
+			if (is_raw_pointer(*type)) {
+				return true;
+			}
+
+			return std::any_of(type->bases.begin(), type->bases.end(), [](const BaseClass& base) { return contains_raw_pointer(base.base_id); })
+				|| std::any_of(type->fields.begin(), type->fields.end(), [](const Field& field) { return contains_raw_pointer(field.type); });
+		}
+
+		void add_bytes_step(std::vector<MemberStep>& steps, size_t offset, size_t size)
+		{
+			// Merge with the previous run when there's no padding in between
+			if (!steps.empty() && steps.back().kind == MemberStep::Kind::Bytes && steps.back().offset + steps.back().size == offset) {
+				steps.back().size += size;
+				return;
+			}
+
+			steps.push_back(MemberStep{ .kind = MemberStep::Kind::Bytes, .offset = offset, .size = size });
+		}
+
+		std::unique_ptr<CopyPlan> compile_plan(const Type& type)
+		{
+			auto plan = std::make_unique<CopyPlan>();
+			plan->version = get_versioned_id(type.id);
+			plan->size = type.size;
+			plan->alignment = type.alignment;
+			plan->default_constructor = type.default_constructor;
+			plan->destructor = type.destructor;
+			plan->copy_n = type.copy_n;
+			plan->pointer = type.pointer_operations;
+
+			const bool has_members = !type.bases.empty() || !type.fields.empty();
+			const bool has_raw_pointer = contains_raw_pointer(type.id);
+			const bool all_bases_reachable = std::all_of(type.bases.begin(), type.bases.end(), [](const BaseClass& base) { return base.upcast != nullptr; });
+
+			for (const BaseClass& base : type.bases) {
+				if (base.upcast != nullptr) {
+					plan->member_steps.push_back(MemberStep{ .kind = MemberStep::Kind::Base, .type_id = base.base_id, .upcast = base.upcast });
+				}
+			}
+			for (const Field& field : type.fields) {
+				if (field.offset.has_value() && has_flags(field.type_flags, TypeFlags::TriviallyCopyable) && !contains_raw_pointer(field.type)) {
+					add_bytes_step(plan->member_steps, *field.offset, field.size);
+				} else if (field.offset.has_value()) {
+					plan->member_steps.push_back(MemberStep{ .kind = MemberStep::Kind::Member, .offset = *field.offset, .type_id = field.type });
+				} else {
+					plan->member_steps.push_back(MemberStep{ .kind = MemberStep::Kind::IndirectMember, .type_id = field.type, .get_address = field.get_address });
+				}
+			}
+
+			if (is_raw_pointer(type)) {
+				plan->kind = CopyKind::RawPointer;
+			} else if (type.has_flags(TypeFlags::TriviallyCopyable) && !has_raw_pointer) {
+				plan->kind = CopyKind::Bytes;
+			} else if (type.copy_n != nullptr && !has_raw_pointer) {
+				// The copy constructor knows best, e.g. it can share or skip members. Non copyable members
+				// (`std::unique_ptr`) make the whole type non copyable, those are cloned member by member.
+				plan->kind = CopyKind::CopyConstruct;
+			} else if (has_members && type.default_constructor != nullptr && all_bases_reachable) {
+				// A base without an upcast (e.g. a private base) couldn't be cloned, it would be left default constructed.
+				plan->kind = CopyKind::Members;
+			} else if (type.copy_n != nullptr) {
+				plan->kind = CopyKind::CopyConstruct;
+			} else if (type.pointer_operations != nullptr && type.pointer_operations->emplace != nullptr && type.default_constructor != nullptr) {
+				plan->kind = CopyKind::OwningPointer;
+			}
+
+			return plan;
+		}
+
+		// Plans are recompiled when the type was replaced, see `replace_type`.
+		std::unordered_map<TemplateTypeId, std::unique_ptr<CopyPlan>> copy_plans;
+
+		const CopyPlan* get_plan(TemplateTypeId type_id)
+		{
+			std::unique_ptr<CopyPlan>& plan = copy_plans[type_id];
+			if (plan != nullptr && is_current(plan->version)) {
+				return plan.get();
+			}
+
+			const Type* type = get_type(type_id);
+			assert(type != nullptr && "clone needs every reachable type to be registered.");
+			if (type == nullptr) {
+				return nullptr;
+			}
+
+			plan = compile_plan(*type);
+			return plan.get();
+		}
+
+		void* offset_by(void* object, size_t offset)
+		{
+			return static_cast<std::byte*>(object) + offset;
+		}
+
+		// State of cloning a single object
+		struct CloneContext
+		{
+			CloneArena* arena;
+			std::unordered_map<const void*, void*> clones; // Source object to its clone, so shared and cyclic raw pointees are cloned once
+		};
+
+		bool construct(const CopyPlan& plan, TemplateTypeId type_id, void* source, void* destination, CloneContext& context);
+
+		// The destination member is already constructed
+		bool clone_member(TemplateTypeId type_id, void* source, void* destination, CloneContext& context)
+		{
+			const CopyPlan* plan = get_plan(type_id);
+			if (plan == nullptr || plan->kind == CopyKind::None) {
+				return false;
+			}
+
+			if (plan->kind == CopyKind::Bytes) {
+				std::memcpy(destination, source, plan->size);
+				return true;
+			}
+
+			if (plan->destructor != nullptr) {
+				plan->destructor(AnyPtr{ destination, type_id });
+			}
+			return construct(*plan, type_id, source, destination, context);
+		}
+
+		bool clone_members(const CopyPlan& plan, TemplateTypeId type_id, void* source, void* destination, CloneContext& context)
+		{
+			bool cloned = true;
+
+			for (const MemberStep& step : plan.member_steps) {
+				switch (step.kind) {
+				case MemberStep::Kind::Bytes:
+					std::memcpy(offset_by(destination, step.offset), offset_by(source, step.offset), step.size);
+					break;
+				case MemberStep::Kind::Member:
+					cloned &= clone_member(step.type_id, offset_by(source, step.offset), offset_by(destination, step.offset), context);
+					break;
+				case MemberStep::Kind::IndirectMember:
+					cloned &= clone_member(step.type_id, step.get_address(AnyPtr{ source, type_id }).value_ptr, step.get_address(AnyPtr{ destination, type_id }).value_ptr, context);
+					break;
+				case MemberStep::Kind::Base: {
+					// Only the members, constructing the base in place would overwrite the derived object's vtable pointer.
+					const CopyPlan* base_plan = get_plan(step.type_id);
+					cloned &= base_plan != nullptr
+						&& clone_members(*base_plan, step.type_id, step.upcast(AnyPtr{ source, type_id }).value_ptr, step.upcast(AnyPtr{ destination, type_id }).value_ptr, context);
+					break;
+				}
+				}
+			}
+
+			return cloned;
+		}
+
+		bool clone_owning_pointer(const CopyPlan& plan, TemplateTypeId type_id, void* source, void* destination, CloneContext& context)
+		{
+			plan.default_constructor(AnyPtr{ destination, type_id });
+
+			const AnyPtr pointee = plan.pointer->get(source);
+			if (pointee.value_ptr == nullptr) {
+				return true;
+			}
+
+			// `emplace` creates an object of the static type, derived pointees can't be cloned this way.
+			if (pointee.type_id != plan.pointer->pointee_type()) {
+				return false;
+			}
+
+			const AnyPtr new_pointee = plan.pointer->emplace(destination);
+			return clone_member(pointee.type_id, pointee.value_ptr, new_pointee.value_ptr, context);
+		}
+
+		bool clone_raw_pointer(void* source, void* destination, const PointerOperations& pointer, CloneContext& context)
+		{
+			std::memcpy(destination, source, sizeof(void*));
+
+			const AnyPtr pointee = pointer.get(source);
+			if (context.arena == nullptr || pointee.value_ptr == nullptr) {
+				return true;
+			}
+
+			bool cloned = true;
+			void* storage = nullptr;
+			if (auto it = context.clones.find(pointee.value_ptr); it != context.clones.end()) {
+				storage = it->second;
+			} else {
+				const CopyPlan* pointee_plan = get_plan(pointee.type_id);
+				if (pointee_plan == nullptr || pointee_plan->kind == CopyKind::None) {
+					return false;
+				}
+
+				// Registered before cloning, pointers back to the pointee then point to its clone instead of recursing.
+				storage = context.arena->allocate(pointee_plan->size, pointee_plan->alignment);
+				context.clones.emplace(pointee.value_ptr, storage);
+				cloned = construct(*pointee_plan, pointee.type_id, pointee.value_ptr, storage, context);
+				if (pointee_plan->destructor != nullptr) {
+					context.arena->add_destructor(AnyPtr{ storage, pointee.type_id }, pointee_plan->destructor);
+				}
+			}
+
+			// The pointer can point to a base subobject of the pointee, keep the same offset into the new object.
+			void* source_pointer = nullptr;
+			std::memcpy(&source_pointer, source, sizeof(void*));
+			void* destination_pointer = offset_by(storage, static_cast<std::byte*>(source_pointer) - static_cast<std::byte*>(pointee.value_ptr));
+			std::memcpy(destination, &destination_pointer, sizeof(void*));
+
+			return cloned;
+		}
+
+		bool construct(const CopyPlan& plan, TemplateTypeId type_id, void* source, void* destination, CloneContext& context)
+		{
+			switch (plan.kind) {
+			case CopyKind::None:
+				return false;
+			case CopyKind::Bytes:
+				std::memcpy(destination, source, plan.size);
+				return true;
+			case CopyKind::CopyConstruct:
+				plan.copy_n(AnyPtr{ destination, type_id }, AnyPtr{ source, type_id }, 1);
+				return true;
+			case CopyKind::Members:
+				plan.default_constructor(AnyPtr{ destination, type_id });
+				return clone_members(plan, type_id, source, destination, context);
+			case CopyKind::OwningPointer:
+				return clone_owning_pointer(plan, type_id, source, destination, context);
+			case CopyKind::RawPointer:
+				return clone_raw_pointer(source, destination, *plan.pointer, context);
+			}
+
+			return false;
+		}
+	}
+
+	bool clone(AnyPtr source, AnyPtr uninitialised_destination, CloneArena* arena)
+	{
+		return clone_n(source, uninitialised_destination, 1, arena);
+	}
+
+	bool clone_n(AnyPtr prototype, AnyPtr uninitialised_destinations, size_t count, CloneArena* arena)
+	{
+		assert(prototype.type_id == uninitialised_destinations.type_id);
+
+		const CopyPlan* plan = get_plan(prototype.type_id);
+		if (plan == nullptr || plan->kind == CopyKind::None) {
+			return false;
+		}
+
+		std::byte* destination = static_cast<std::byte*>(uninitialised_destinations.value_ptr);
+		if (plan->kind == CopyKind::Bytes) {
+			for (size_t i = 0; i < count; ++i) {
+				std::memcpy(destination + i * plan->size, prototype.value_ptr, plan->size);
+			}
+			return true;
+		}
+
+		// Each clone gets its own copies of the raw pointees, pointers back to the prototype point to the clone.
+		bool cloned = true;
+		CloneContext context{ arena, {} };
+		for (size_t i = 0; i < count; ++i) {
+			context.clones.clear();
+			context.clones.emplace(prototype.value_ptr, destination + i * plan->size);
+			cloned &= construct(*plan, prototype.type_id, prototype.value_ptr, destination + i * plan->size, context);
+		}
+		return cloned;
+	}
+}
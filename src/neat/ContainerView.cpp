@@ -0,0 +1,69 @@
+#include "neat/ContainerView.h"
+#include "neat/Reflection.h"
+
+#include <cstddef>
+#include <cstring>
+
+
+namespace Neat
+{
+	SequenceView SequenceView::create(AnyPtr container)
+	{
+		const Type* type = get_type(container.type_id);
+		if (type == nullptr || type->sequence_operations == nullptr) {
+			return SequenceView{};
+		}
+
+		return SequenceView{ container, *type->sequence_operations };
+	}
+
+	bool SequenceView::assign(const void* elements, size_t count) const
+	{
+		if (is_contiguous() && operations->element_trivially_copyable && (is_resizable() || count == size())) {
+			if (is_resizable()) {
+				resize(count);
+			}
+			if (count > 0) {
+				std::memcpy(data(), elements, count * element_size());
+			}
+			return true;
+		}
+
+		if (operations->clear == nullptr || operations->push_back == nullptr) {
+			// Fixed size sequences of non trivially copyable elements are assigned one element at a time
+			const Type* element_type = get_type(element_type_id);
+			if (count != size() || element_type == nullptr || element_type->copy_assign_n == nullptr) {
+				return false;
+			}
+
+			if (is_contiguous()) {
+				element_type->copy_assign_n(AnyPtr{ data(), element_type_id }, AnyPtr{ const_cast<void*>(elements), element_type_id }, count);
+				return true;
+			}
+			const std::byte* element = static_cast<const std::byte*>(elements);
+			for (size_t i = 0; i < count; ++i) {
+				element_type->copy_assign_n(AnyPtr{ operations->at(container_ptr.value_ptr, i), element_type_id }, AnyPtr{ const_cast<std::byte*>(element + i * element_size()), element_type_id }, 1);
+			}
+			return true;
+		}
+
+		clear();
+		reserve(count);
+
+		const std::byte* element = static_cast<const std::byte*>(elements);
+		for (size_t i = 0; i < count; ++i) {
+			operations->push_back(container_ptr.value_ptr, element + i * element_size());
+		}
+		return true;
+	}
+
+	MapView MapView::create(AnyPtr container)
+	{
+		const Type* type = get_type(container.type_id);
+		if (type == nullptr || type->map_operations == nullptr) {
+			return MapView{};
+		}
+
+		return MapView{ container, *type->map_operations };
+	}
+}
@@ -0,0 +1,169 @@
+#include "neat/Conversion.h"
+
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+#include <cassert>
+
+
+namespace Neat
+{
+	namespace
+	{
+		template<typename... Ts>
+		struct TypeList {};
+
+		using ArithmeticTypes = TypeList<bool, char, signed char, unsigned char, short, unsigned short, int, unsigned int,
+			long, unsigned long, long long, unsigned long long, float, double, long double>;
+
+		template<typename T>
+		Any number_to_string_conversion(AnyConstRef value)
+		{
+			if constexpr (std::is_same_v<T, bool>) {
+				return std::string{ value.get<bool>() ? "true" : "false" };
+			} else {
+				return std::to_string(value.get<T>());
+			}
+		}
+
+		template<typename T>
+		Any string_to_number_conversion(AnyConstRef value)
+		{
+			std::string_view string = value.get<std::string>();
+
+			if constexpr (std::is_same_v<T, bool>) {
+				if (string == "true" || string == "1") { return true; }
+				if (string == "false" || string == "0") { return false; }
+				return Any{};
+			} else if constexpr (std::is_same_v<T, long double>) {
+				// from_chars for long double isn't available everywhere, parse as double instead.
+				double result{};
+				auto [end, error] = std::from_chars(string.data(), string.data() + string.size(), result);
+				if (error != std::errc{} || end != string.data() + string.size()) { return Any{}; }
+				return static_cast<long double>(result);
+			} else {
+				T result{};
+				auto [end, error] = std::from_chars(string.data(), string.data() + string.size(), result);
+				if (error != std::errc{} || end != string.data() + string.size()) { return Any{}; }
+				return result;
+			}
+		}
+
+		Any string_identity_conversion(AnyConstRef value)
+		{
+			return value.get<std::string>();
+		}
+
+		// Storage for all conversions.
+		// Ids from the automatic id counter are small, so they index into the dense table.
+		// Manually assigned ids can be arbitrarily large, these go into a sparse map instead.
+		struct ConversionContainer
+		{
+			static constexpr TemplateTypeId c_max_dense_id = 4096;
+
+			std::vector<std::vector<ConvertFunction>> dense; // dense[from][to]
+			std::unordered_map<uint64_t, ConvertFunction> sparse;
+
+			static uint64_t sparse_key(TemplateTypeId from, TemplateTypeId to)
+			{
+				return (static_cast<uint64_t>(from) << 32) | static_cast<uint64_t>(to);
+			}
+
+			void set(TemplateTypeId from, TemplateTypeId to, ConvertFunction function)
+			{
+				if (from >= c_max_dense_id || to >= c_max_dense_id) {
+					sparse[sparse_key(from, to)] = function;
+					return;
+				}
+
+				if (dense.size() <= from) {
+					dense.resize(from + 1);
+				}
+				auto& row = dense[from];
+				if (row.size() <= to) {
+					row.resize(to + 1, nullptr);
+				}
+				row[to] = function;
+			}
+
+			ConvertFunction get(TemplateTypeId from, TemplateTypeId to) const
+			{
+				if (from >= c_max_dense_id || to >= c_max_dense_id) {
+					auto it = sparse.find(sparse_key(from, to));
+					return (it != sparse.end()) ? it->second : nullptr;
+				}
+
+				if (from >= dense.size()) {
+					return nullptr;
+				}
+				const auto& row = dense[from];
+				return (to < row.size()) ? row[to] : nullptr;
+			}
+		};
+
+		template<typename TFrom, typename... TTos>
+		void register_conversions_from(ConversionContainer& container, TypeList<TTos...>)
+		{
+			(container.set(get_id<TFrom>(), get_id<TTos>(), &Detail::static_cast_conversion_erased<TFrom, TTos>), ...);
+			container.set(get_id<TFrom>(), get_id<std::string>(), &number_to_string_conversion<TFrom>);
+			container.set(get_id<std::string>(), get_id<TFrom>(), &string_to_number_conversion<TFrom>);
+		}
+
+		template<typename... TFroms>
+		void register_builtin_conversions(ConversionContainer& container, TypeList<TFroms...> types)
+		{
+			(register_conversions_from<TFroms>(container, types), ...);
+			container.set(get_id<std::string>(), get_id<std::string>(), &string_identity_conversion);
+		}
+
+		ConversionContainer& get_conversion_container()
+		{
+			static ConversionContainer container = [] {
+				ConversionContainer builtin_container{};
+				register_builtin_conversions(builtin_container, ArithmeticTypes{});
+				return builtin_container;
+			}();
+
+			return container;
+		}
+	}
+
+
+	void register_conversion(TemplateTypeId from, TemplateTypeId to, ConvertFunction function)
+	{
+		assert(from != c_empty_type_id && to != c_empty_type_id);
+
+		get_conversion_container().set(from, to, function);
+	}
+
+	ConvertFunction get_conversion(TemplateTypeId from, TemplateTypeId to)
+	{
+		return get_conversion_container().get(from, to);
+	}
+
+	Any convert(const Any& value, TemplateTypeId to)
+	{
+		if (value.type_id() == to) {
+			return value;
+		}
+
+		return convert(value.to_any_ref(), to);
+	}
+
+	Any convert(AnyConstRef value, TemplateTypeId to)
+	{
+		if (!value.has_value()) {
+			return Any{};
+		}
+
+		ConvertFunction function = get_conversion(value.type_id, to);
+		if (function == nullptr) {
+			return Any{};
+		}
+
+		return function(value);
+	}
+}
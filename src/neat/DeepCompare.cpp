@@ -0,0 +1,414 @@
+#include "neat/DeepCompare.h"
+#include "neat/Reflection.h"
+#include "neat/ContainerOperations.h"
+#include "neat/PointerOperations.h"
+#include "neat/ValueOperations.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+
+namespace Neat
+{
+	namespace
+	{
+		struct CompareStep
+		{
+			enum class Kind : uint8_t
+			{
+				Bytes, // memcmp over [offset, offset + size)
+				Member, // Recurse into the member at `offset`
+				IndirectMember, // Recurse into the member returned by `get_address`
+				Base, // Recurse into the base returned by `upcast`
+				Sequence,
+				Map,
+				Pointer,
+				Value, // The type's own operator== and std::hash
+			};
+
+			Kind kind;
+			size_t offset = 0;
+			size_t size = 0;
+			TemplateTypeId type_id = c_empty_type_id; // The member, base or element type
+			Field::GetAddressFunction get_address = nullptr;
+			BaseClass::UpcastFunction upcast = nullptr;
+			const SequenceOperations* sequence = nullptr;
+			const MapOperations* map = nullptr;
+			const PointerOperations* pointer = nullptr;
+			const ValueOperations* value = nullptr;
+		};
+
+		struct ComparePlan
+		{
+			VersionedTypeId version;
+			std::vector<CompareStep> steps;
+			size_t size = 0;
+			bool is_bytes = false; // A single memcmp over the whole object
+			bool is_comparable = true;
+		};
+
+		void add_bytes_step(std::vector<CompareStep>& steps, size_t offset, size_t size)
+		{
+			// Merge with the previous run when there's no padding in between
+			if (!steps.empty() && steps.back().kind == CompareStep::Kind::Bytes && steps.back().offset + steps.back().size == offset) {
+				steps.back().size += size;
+				return;
+			}
+
+			steps.push_back(CompareStep{ .kind = CompareStep::Kind::Bytes, .offset = offset, .size = size });
+		}
+
+		std::unique_ptr<ComparePlan> compile_plan(const Type& type)
+		{
+			auto plan = std::make_unique<ComparePlan>();
+			plan->version = get_versioned_id(type.id);
+			plan->size = type.size;
+			auto& steps = plan->steps;
+
+			// Bases without an upcast (e.g. private bases) can't be reached, so the members alone don't decide equality.
+			const bool has_members = !type.bases.empty() || !type.fields.empty();
+			const bool all_bases_reachable = std::all_of(type.bases.begin(), type.bases.end(), [](const BaseClass& base) { return base.upcast != nullptr; });
+			const bool has_equal = type.value_operations != nullptr && type.value_operations->equal != nullptr;
+
+			if (type.has_flags(TypeFlags::HasUniqueObjectRepresentations)) {
+				add_bytes_step(steps, 0, type.size);
+				plan->is_bytes = true;
+			} else if (type.sequence_operations != nullptr) {
+				steps.push_back(CompareStep{ .kind = CompareStep::Kind::Sequence, .type_id = type.sequence_operations->element_type(), .sequence = type.sequence_operations });
+			} else if (type.map_operations != nullptr) {
+				steps.push_back(CompareStep{ .kind = CompareStep::Kind::Map, .type_id = type.map_operations->mapped_type(), .map = type.map_operations });
+			} else if (type.pointer_operations != nullptr) {
+				steps.push_back(CompareStep{ .kind = CompareStep::Kind::Pointer, .pointer = type.pointer_operations });
+			} else if (has_members && all_bases_reachable) {
+				for (const BaseClass& base : type.bases) {
+					steps.push_back(CompareStep{ .kind = CompareStep::Kind::Base, .type_id = base.base_id, .upcast = base.upcast });
+				}
+
+				for (const Field& field : type.fields) {
+					if (field.offset.has_value() && has_flags(field.type_flags, TypeFlags::HasUniqueObjectRepresentations)) {
+						add_bytes_step(steps, *field.offset, field.size);
+					} else if (field.offset.has_value()) {
+						steps.push_back(CompareStep{ .kind = CompareStep::Kind::Member, .offset = *field.offset, .type_id = field.type });
+					} else {
+						steps.push_back(CompareStep{ .kind = CompareStep::Kind::IndirectMember, .type_id = field.type, .get_address = field.get_address });
+					}
+				}
+			} else if (has_equal) {
+				steps.push_back(CompareStep{ .kind = CompareStep::Kind::Value, .value = type.value_operations });
+			} else {
+				plan->is_comparable = false;
+			}
+
+			return plan;
+		}
+
+		// Plans are recompiled when the type was replaced, see `replace_type`.
+		std::unordered_map<TemplateTypeId, std::unique_ptr<ComparePlan>> compare_plans;
+
+		const ComparePlan* get_plan(TemplateTypeId type_id)
+		{
+			std::unique_ptr<ComparePlan>& plan = compare_plans[type_id];
+			if (plan != nullptr && is_current(plan->version)) {
+				return plan.get();
+			}
+
+			const Type* type = get_type(type_id);
+			assert(type != nullptr && "deep_equal and deep_hash need every reachable type to be registered.");
+			if (type == nullptr) {
+				return nullptr;
+			}
+
+			plan = compile_plan(*type);
+			return plan.get();
+		}
+
+		struct PointeePairHash
+		{
+			size_t operator()(const std::pair<const void*, const void*>& pointees) const
+			{
+				size_t seed = std::hash<const void*>{}(pointees.first);
+				HashUtils::combine(seed, std::hash<const void*>{}(pointees.second));
+				return seed;
+			}
+		};
+
+		// State of a single deep_equal or deep_hash call. Owning pointers can form cycles (e.g. shared_ptr back references),
+		// the pointees currently being compared or hashed are kept to stop there instead of recursing forever.
+		struct CompareContext
+		{
+			std::unordered_set<std::pair<const void*, const void*>, PointeePairHash> pointees_in_progress;
+		};
+
+		void* offset_by(void* object, size_t offset)
+		{
+			return static_cast<std::byte*>(object) + offset;
+		}
+
+		// Equality
+		// ===========================================================================
+
+		bool equal(TemplateTypeId type_id, void* a, void* b, CompareContext& context);
+
+		bool equal_sequences(const CompareStep& step, void* a, void* b, CompareContext& context)
+		{
+			const size_t size = step.sequence->size(a);
+			if (size != step.sequence->size(b)) {
+				return false;
+			}
+
+			const ComparePlan* element_plan = get_plan(step.type_id);
+			if (element_plan != nullptr && element_plan->is_bytes && step.sequence->data != nullptr) {
+				return size == 0 || std::memcmp(step.sequence->data(a), step.sequence->data(b), size * element_plan->size) == 0;
+			}
+
+			for (size_t i = 0; i < size; ++i) {
+				if (!equal(step.type_id, step.sequence->at(a, i), step.sequence->at(b, i), context)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		bool equal_maps(const CompareStep& step, void* a, void* b, CompareContext& compare_context)
+		{
+			if (step.map->size(a) != step.map->size(b)) {
+				return false;
+			}
+
+			struct Context
+			{
+				const CompareStep& step;
+				void* other;
+				CompareContext& compare_context;
+				bool equal = true;
+			};
+			Context context{ step, b, compare_context };
+
+			step.map->for_each(a, [](void* context_ptr, const void* key, void* value) {
+				Context& context = *static_cast<Context*>(context_ptr);
+				if (!context.equal) {
+					return;
+				}
+
+				void* other_value = context.step.map->find(context.other, key);
+				context.equal = other_value != nullptr && equal(context.step.type_id, value, other_value, context.compare_context);
+			}, &context);
+
+			return context.equal;
+		}
+
+		bool equal_pointers(const CompareStep& step, void* a, void* b, CompareContext& context)
+		{
+			const AnyPtr pointee_a = step.pointer->get(a);
+			const AnyPtr pointee_b = step.pointer->get(b);
+			if (pointee_a.value_ptr == nullptr || pointee_b.value_ptr == nullptr || pointee_a.value_ptr == pointee_b.value_ptr) {
+				return pointee_a.value_ptr == pointee_b.value_ptr;
+			}
+			if (pointee_a.type_id != pointee_b.type_id) {
+				return false;
+			}
+
+			// A pair which is already being compared further up closes a cycle, any difference is found up there.
+			const auto [it, inserted] = context.pointees_in_progress.insert({ pointee_a.value_ptr, pointee_b.value_ptr });
+			if (!inserted) {
+				return true;
+			}
+
+			const bool pointees_equal = equal(pointee_a.type_id, pointee_a.value_ptr, pointee_b.value_ptr, context);
+			context.pointees_in_progress.erase(it);
+			return pointees_equal;
+		}
+
+		bool equal(const ComparePlan& plan, TemplateTypeId type_id, void* a, void* b, CompareContext& context)
+		{
+			for (const CompareStep& step : plan.steps) {
+				bool step_equal = true;
+
+				switch (step.kind) {
+				case CompareStep::Kind::Bytes:
+					step_equal = std::memcmp(offset_by(a, step.offset), offset_by(b, step.offset), step.size) == 0;
+					break;
+				case CompareStep::Kind::Member:
+					step_equal = equal(step.type_id, offset_by(a, step.offset), offset_by(b, step.offset), context);
+					break;
+				case CompareStep::Kind::IndirectMember:
+					step_equal = equal(step.type_id, step.get_address(AnyPtr{ a, type_id }).value_ptr, step.get_address(AnyPtr{ b, type_id }).value_ptr, context);
+					break;
+				case CompareStep::Kind::Base:
+					step_equal = equal(step.type_id, step.upcast(AnyPtr{ a, type_id }).value_ptr, step.upcast(AnyPtr{ b, type_id }).value_ptr, context);
+					break;
+				case CompareStep::Kind::Sequence:
+					step_equal = equal_sequences(step, a, b, context);
+					break;
+				case CompareStep::Kind::Map:
+					step_equal = equal_maps(step, a, b, context);
+					break;
+				case CompareStep::Kind::Pointer:
+					step_equal = equal_pointers(step, a, b, context);
+					break;
+				case CompareStep::Kind::Value:
+					step_equal = step.value->equal(a, b);
+					break;
+				}
+
+				if (!step_equal) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		bool equal(TemplateTypeId type_id, void* a, void* b, CompareContext& context)
+		{
+			const ComparePlan* plan = get_plan(type_id);
+			if (plan == nullptr || !plan->is_comparable) {
+				assert(plan == nullptr || !"The type has no fields, container or comparison operator to compare with, or a base which can't be reached.");
+				return false;
+			}
+
+			return equal(*plan, type_id, a, b, context);
+		}
+
+		// Hashing
+		// ===========================================================================
+
+		size_t hash(TemplateTypeId type_id, void* object, CompareContext& context);
+
+		size_t hash_sequence(const CompareStep& step, void* object, CompareContext& context)
+		{
+			const size_t size = step.sequence->size(object);
+			size_t seed = size;
+
+			const ComparePlan* element_plan = get_plan(step.type_id);
+			if (element_plan != nullptr && element_plan->is_bytes && step.sequence->data != nullptr) {
+				HashUtils::combine(seed, hash_bytes(step.sequence->data(object), size * element_plan->size));
+				return seed;
+			}
+
+			for (size_t i = 0; i < size; ++i) {
+				HashUtils::combine(seed, hash(step.type_id, step.sequence->at(object, i), context));
+			}
+			return seed;
+		}
+
+		size_t hash_map(const CompareStep& step, void* object, CompareContext& compare_context)
+		{
+			struct Context
+			{
+				const CompareStep& step;
+				CompareContext& compare_context;
+				size_t sum = 0;
+			};
+			Context context{ step, compare_context };
+
+			// Summing the entry hashes keeps the result independent of the iteration order.
+			step.map->for_each(object, [](void* context_ptr, const void* key, void* value) {
+				Context& context = *static_cast<Context*>(context_ptr);
+				size_t entry_hash = hash(context.step.map->key_type(), const_cast<void*>(key), context.compare_context);
+				HashUtils::combine(entry_hash, hash(context.step.type_id, value, context.compare_context));
+				context.sum += entry_hash;
+			}, &context);
+
+			size_t seed = step.map->size(object);
+			HashUtils::combine(seed, context.sum);
+			return seed;
+		}
+
+		size_t hash_pointee(const CompareStep& step, void* object, CompareContext& context)
+		{
+			const AnyPtr pointee = step.pointer->get(object);
+			if (pointee.value_ptr == nullptr) {
+				return 0;
+			}
+
+			// A pointee which is already being hashed further up closes a cycle, it only adds a constant.
+			const auto [it, inserted] = context.pointees_in_progress.insert({ pointee.value_ptr, nullptr });
+			if (!inserted) {
+				return 1;
+			}
+
+			const size_t pointee_hash = hash(pointee.type_id, pointee.value_ptr, context);
+			context.pointees_in_progress.erase(it);
+			return pointee_hash;
+		}
+
+		size_t hash(const ComparePlan& plan, TemplateTypeId type_id, void* object, CompareContext& context)
+		{
+			size_t seed = 0;
+
+			for (const CompareStep& step : plan.steps) {
+				size_t step_hash = 0;
+
+				switch (step.kind) {
+				case CompareStep::Kind::Bytes:
+					step_hash = hash_bytes(offset_by(object, step.offset), step.size);
+					break;
+				case CompareStep::Kind::Member:
+					step_hash = hash(step.type_id, offset_by(object, step.offset), context);
+					break;
+				case CompareStep::Kind::IndirectMember:
+					step_hash = hash(step.type_id, step.get_address(AnyPtr{ object, type_id }).value_ptr, context);
+					break;
+				case CompareStep::Kind::Base:
+					step_hash = hash(step.type_id, step.upcast(AnyPtr{ object, type_id }).value_ptr, context);
+					break;
+				case CompareStep::Kind::Sequence:
+					step_hash = hash_sequence(step, object, context);
+					break;
+				case CompareStep::Kind::Map:
+					step_hash = hash_map(step, object, context);
+					break;
+				case CompareStep::Kind::Pointer:
+					step_hash = hash_pointee(step, object, context);
+					break;
+				case CompareStep::Kind::Value:
+					assert(step.value->hash != nullptr && "The type has an operator== but no std::hash specialisation.");
+					step_hash = step.value->hash != nullptr ? step.value->hash(object) : 0;
+					break;
+				}
+
+				HashUtils::combine(seed, step_hash);
+			}
+
+			return seed;
+		}
+
+		size_t hash(TemplateTypeId type_id, void* object, CompareContext& context)
+		{
+			const ComparePlan* plan = get_plan(type_id);
+			if (plan == nullptr || !plan->is_comparable) {
+				assert(plan == nullptr || !"The type has no fields, container or hash function to hash with, or a base which can't be reached.");
+				return 0;
+			}
+
+			return hash(*plan, type_id, object, context);
+		}
+	}
+
+	bool deep_equal(AnyPtr a, AnyPtr b)
+	{
+		if (a.type_id != b.type_id) {
+			return false;
+		}
+		if (a.value_ptr == b.value_ptr) {
+			return true;
+		}
+
+		CompareContext context{};
+		return equal(a.type_id, a.value_ptr, b.value_ptr, context);
+	}
+
+	size_t deep_hash(AnyPtr object)
+	{
+		CompareContext context{};
+		return hash(object.type_id, object.value_ptr, context);
+	}
+}
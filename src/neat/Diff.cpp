@@ -0,0 +1,633 @@
+#include "neat/Diff.h"
+#include "neat/Reflection.h"
+#include "neat/ContainerOperations.h"
+#include "neat/PointerOperations.h"
+#include "neat/DeepCompare.h"
+#include "neat/Enum.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <unordered_map>
+
+
+namespace Neat
+{
+	namespace
+	{
+		struct PatchMember
+		{
+			enum class Kind : uint8_t
+			{
+				Bytes, // At `offset`, its bytes fully represent its value
+				Member, // Recurse into the member at `offset`
+				IndirectMember, // Recurse into the member returned by `get_address`
+				Base, // Recurse into the base returned by `upcast`
+			};
+
+			Kind kind;
+			size_t offset = 0;
+			size_t size = 0;
+			TemplateTypeId type_id = c_empty_type_id; // The member or base type
+			Field::GetAddressFunction get_address = nullptr;
+			BaseClass::UpcastFunction upcast = nullptr;
+
+			// Adjacent bytes members form a run, compared with a single memcmp.
+			uint32_t run_last = 0; // Ordinal of the run's last member
+			size_t run_end = 0; // Offset past the run
+		};
+
+		enum class PlanKind : uint8_t
+		{
+			Unsupported,
+			Bytes, // Trivially copyable without reflected members, compared and assigned as a whole
+			Members,
+			Sequence,
+			Pointer, // Owning pointers
+			Compared, // Changes are detected with `deep_equal`, but can't be represented. Also raw pointers, an address means nothing to the receiver.
+		};
+
+		struct PatchPlan
+		{
+			VersionedTypeId version;
+			PlanKind kind = PlanKind::Unsupported;
+			std::vector<PatchMember> members; // Indexed by member ordinal, the bases first
+			size_t size = 0;
+			size_t alignment = 1;
+			Type::DefaultConstructor default_constructor = nullptr;
+			Type::Destructor destructor = nullptr;
+			const SequenceOperations* sequence = nullptr;
+			const PointerOperations* pointer = nullptr;
+			TemplateTypeId element_type = c_empty_type_id;
+			bool elements_are_bytes = false; // Contiguous `is_bytes` elements, the sequence is assigned as a whole
+			bool is_bytes = false; // Any bytes are a valid value, it can be part of a run or compared with memcmp as a whole
+			bool is_bool = false; // Bytes plans whose payload needs to be validated
+			bool is_enum = false;
+		};
+
+		const PatchPlan* get_plan(TemplateTypeId type_id);
+
+		bool is_bytes_field(const Field& field)
+		{
+			if (!field.offset.has_value() || !has_flags(field.type_flags, TypeFlags::TriviallyCopyable)) {
+				return false;
+			}
+
+			const PatchPlan* field_plan = get_plan(field.type);
+			return field_plan != nullptr && field_plan->is_bytes;
+		}
+
+		void compile_members(const Type& type, std::vector<PatchMember>& members)
+		{
+			// Bases without an upcast keep their ordinal, but can't be reached.
+			for (const BaseClass& base : type.bases) {
+				members.push_back(PatchMember{ .kind = PatchMember::Kind::Base, .type_id = base.base_id, .upcast = base.upcast });
+			}
+
+			for (const Field& field : type.fields) {
+				if (is_bytes_field(field)) {
+					members.push_back(PatchMember{ .kind = PatchMember::Kind::Bytes, .offset = *field.offset, .size = field.size, .type_id = field.type });
+				} else if (field.offset.has_value()) {
+					members.push_back(PatchMember{ .kind = PatchMember::Kind::Member, .offset = *field.offset, .size = field.size, .type_id = field.type });
+				} else {
+					members.push_back(PatchMember{ .kind = PatchMember::Kind::IndirectMember, .size = field.size, .type_id = field.type, .get_address = field.get_address });
+				}
+			}
+
+			// Extend the runs backwards, a member joins the next one's run when there's no padding in between.
+			for (size_t i = members.size(); i-- > 0;) {
+				PatchMember& member = members[i];
+				if (member.kind != PatchMember::Kind::Bytes) {
+					continue;
+				}
+
+				const bool joins_next = i + 1 < members.size() && members[i + 1].kind == PatchMember::Kind::Bytes
+					&& member.offset + member.size == members[i + 1].offset;
+				member.run_last = joins_next ? members[i + 1].run_last : static_cast<uint32_t>(i);
+				member.run_end = joins_next ? members[i + 1].run_end : member.offset + member.size;
+			}
+		}
+
+		std::unique_ptr<PatchPlan> compile_plan(const Type& type)
+		{
+			auto plan = std::make_unique<PatchPlan>();
+			plan->version = get_versioned_id(type.id);
+			plan->size = type.size;
+			plan->alignment = type.alignment;
+			plan->default_constructor = type.default_constructor;
+			plan->destructor = type.destructor;
+
+			if (type.pointer_operations != nullptr && type.pointer_operations->kind == PointerKind::Raw) {
+				plan->kind = PlanKind::Compared;
+			} else if (type.has_flags(TypeFlags::TriviallyCopyable) && type.bases.empty() && type.fields.empty()) {
+				// Not every byte pattern is a bool or an enumerator, these aren't merged into runs so they can be validated.
+				plan->kind = PlanKind::Bytes;
+				plan->is_bool = type.id == get_id<bool>();
+				plan->is_enum = get_enum(type.id) != nullptr;
+				plan->is_bytes = !plan->is_bool && !plan->is_enum;
+			} else if (!type.bases.empty() || !type.fields.empty()) {
+				plan->kind = PlanKind::Members;
+				compile_members(type, plan->members);
+				plan->is_bytes = type.has_flags(TypeFlags::HasUniqueObjectRepresentations)
+					&& std::all_of(plan->members.begin(), plan->members.end(), [](const PatchMember& member) { return member.kind == PatchMember::Kind::Bytes; });
+			} else if (type.sequence_operations != nullptr) {
+				plan->kind = PlanKind::Sequence;
+				plan->sequence = type.sequence_operations;
+				plan->element_type = type.sequence_operations->element_type();
+
+				const PatchPlan* element_plan = get_plan(plan->element_type);
+				plan->elements_are_bytes = type.sequence_operations->data != nullptr && element_plan != nullptr && element_plan->is_bytes;
+			} else if (type.pointer_operations != nullptr) {
+				plan->kind = PlanKind::Pointer;
+				plan->pointer = type.pointer_operations;
+			} else if (type.map_operations != nullptr || (type.value_operations != nullptr && type.value_operations->equal != nullptr)) {
+				plan->kind = PlanKind::Compared;
+			}
+
+			return plan;
+		}
+
+		// Plans are recompiled when the type was replaced, see `replace_type`.
+		std::unordered_map<TemplateTypeId, std::unique_ptr<PatchPlan>> patch_plans;
+
+		const PatchPlan* get_plan(TemplateTypeId type_id)
+		{
+			std::unique_ptr<PatchPlan>& plan = patch_plans[type_id];
+			if (plan != nullptr && is_current(plan->version)) {
+				return plan.get();
+			}
+
+			const Type* type = get_type(type_id);
+			assert(type != nullptr && "diff and apply_patch need every reachable type to be registered.");
+			if (type == nullptr) {
+				return nullptr;
+			}
+
+			plan = compile_plan(*type);
+			return plan.get();
+		}
+
+		void* offset_by(void* object, size_t offset)
+		{
+			return static_cast<std::byte*>(object) + offset;
+		}
+
+		// Diffing
+		// ===========================================================================
+
+		struct DiffContext
+		{
+			std::vector<std::byte>& out;
+			std::vector<uint32_t> path;
+		};
+
+		template<typename T>
+		void write(std::vector<std::byte>& out, T value)
+		{
+			const size_t position = out.size();
+			out.resize(position + sizeof(T));
+			std::memcpy(out.data() + position, &value, sizeof(T));
+		}
+
+		void write_change(DiffContext& context, Patch::Op op)
+		{
+			assert(context.path.size() <= UINT8_MAX && "The change is nested too deep to be represented.");
+
+			write(context.out, op);
+			write(context.out, static_cast<uint8_t>(context.path.size()));
+			for (uint32_t element : context.path) {
+				write(context.out, element);
+			}
+		}
+
+		void write_assign(DiffContext& context, const void* bytes, size_t size)
+		{
+			write_change(context, Patch::Op::Assign);
+			write(context.out, static_cast<uint32_t>(size));
+
+			const size_t position = context.out.size();
+			context.out.resize(position + size);
+			if (size != 0) {
+				std::memcpy(context.out.data() + position, bytes, size);
+			}
+		}
+
+		bool diff(TemplateTypeId type_id, void* old_object, void* new_object, DiffContext& context);
+
+		bool diff_child(uint32_t path_element, TemplateTypeId type_id, void* old_object, void* new_object, DiffContext& context)
+		{
+			context.path.push_back(path_element);
+			const bool represented = diff(type_id, old_object, new_object, context);
+			context.path.pop_back();
+			return represented;
+		}
+
+		// New sequence elements and pointees are diffed against a value initialised object, the way they're created when patching.
+		bool diff_from_default(uint32_t path_element, TemplateTypeId type_id, void* new_object, DiffContext& context)
+		{
+			const PatchPlan* plan = get_plan(type_id);
+			if (plan == nullptr || plan->default_constructor == nullptr) {
+				return false;
+			}
+
+			void* storage = ::operator new(plan->size, std::align_val_t{ plan->alignment });
+			plan->default_constructor(AnyPtr{ storage, type_id });
+			const bool represented = diff_child(path_element, type_id, storage, new_object, context);
+			if (plan->destructor != nullptr) {
+				plan->destructor(AnyPtr{ storage, type_id });
+			}
+			::operator delete(storage, std::align_val_t{ plan->alignment });
+
+			return represented;
+		}
+
+		bool bytes_equal(const PatchMember& member, void* a, void* b)
+		{
+			return std::memcmp(offset_by(a, member.offset), offset_by(b, member.offset), member.size) == 0;
+		}
+
+		bool diff_members(const PatchPlan& plan, TemplateTypeId type_id, void* old_object, void* new_object, DiffContext& context)
+		{
+			bool represented = true;
+
+			for (uint32_t i = 0; i < plan.members.size(); ++i) {
+				const PatchMember& member = plan.members[i];
+
+				switch (member.kind) {
+				case PatchMember::Kind::Bytes: {
+					const uint32_t run_last = member.run_last;
+					if (std::memcmp(offset_by(old_object, member.offset), offset_by(new_object, member.offset), member.run_end - member.offset) != 0) {
+						// Only send the span between the first and the last changed member of the run
+						uint32_t first_changed = i;
+						while (bytes_equal(plan.members[first_changed], old_object, new_object)) {
+							++first_changed;
+						}
+						uint32_t last_changed = run_last;
+						while (bytes_equal(plan.members[last_changed], old_object, new_object)) {
+							--last_changed;
+						}
+
+						const PatchMember& first = plan.members[first_changed];
+						const PatchMember& last = plan.members[last_changed];
+						context.path.push_back(first_changed);
+						write_assign(context, offset_by(new_object, first.offset), last.offset + last.size - first.offset);
+						context.path.pop_back();
+					}
+					i = run_last;
+					break;
+				}
+				case PatchMember::Kind::Member:
+					represented &= diff_child(i, member.type_id, offset_by(old_object, member.offset), offset_by(new_object, member.offset), context);
+					break;
+				case PatchMember::Kind::IndirectMember:
+					represented &= diff_child(i, member.type_id,
+						member.get_address(AnyPtr{ old_object, type_id }).value_ptr, member.get_address(AnyPtr{ new_object, type_id }).value_ptr, context);
+					break;
+				case PatchMember::Kind::Base:
+					// A base without an upcast can't be reached, its changes (if any) can't be represented.
+					represented &= member.upcast != nullptr
+						&& diff_child(i, member.type_id, member.upcast(AnyPtr{ old_object, type_id }).value_ptr, member.upcast(AnyPtr{ new_object, type_id }).value_ptr, context);
+					break;
+				}
+			}
+
+			return represented;
+		}
+
+		bool diff_sequences(const PatchPlan& plan, void* old_object, void* new_object, DiffContext& context)
+		{
+			const SequenceOperations& sequence = *plan.sequence;
+			const size_t old_size = sequence.size(old_object);
+			const size_t new_size = sequence.size(new_object);
+			if (old_size != new_size && sequence.resize == nullptr) {
+				return false;
+			}
+
+			if (plan.elements_are_bytes) {
+				const size_t new_bytes = new_size * sequence.element_size;
+				if (old_size != new_size || (new_size != 0 && std::memcmp(sequence.data(old_object), sequence.data(new_object), new_bytes) != 0)) {
+					write_assign(context, new_size != 0 ? sequence.data(new_object) : nullptr, new_bytes);
+				}
+				return true;
+			}
+
+			if (old_size != new_size) {
+				write_change(context, Patch::Op::Resize);
+				write(context.out, static_cast<uint32_t>(new_size));
+			}
+
+			bool represented = true;
+			for (size_t i = 0; i < new_size; ++i) {
+				const uint32_t index = static_cast<uint32_t>(i);
+				represented &= i < old_size
+					? diff_child(index, plan.element_type, sequence.at(old_object, i), sequence.at(new_object, i), context)
+					: diff_from_default(index, plan.element_type, sequence.at(new_object, i), context);
+			}
+			return represented;
+		}
+
+		bool diff_pointers(const PatchPlan& plan, void* old_object, void* new_object, DiffContext& context)
+		{
+			const AnyPtr old_pointee = plan.pointer->get(old_object);
+			const AnyPtr new_pointee = plan.pointer->get(new_object);
+			if (old_pointee.value_ptr == new_pointee.value_ptr) {
+				return true;
+			}
+			if (new_pointee.value_ptr == nullptr) {
+				write_change(context, Patch::Op::Reset);
+				return true;
+			}
+
+			if (old_pointee.value_ptr != nullptr && old_pointee.type_id == new_pointee.type_id) {
+				return diff_child(c_patch_pointee, new_pointee.type_id, old_pointee.value_ptr, new_pointee.value_ptr, context);
+			}
+
+			// Emplace creates an object of the static type, derived pointees can't be represented.
+			if (plan.pointer->emplace == nullptr || new_pointee.type_id != plan.pointer->pointee_type()) {
+				return false;
+			}
+
+			write_change(context, Patch::Op::Emplace);
+			return diff_from_default(c_patch_pointee, new_pointee.type_id, new_pointee.value_ptr, context);
+		}
+
+		bool diff(TemplateTypeId type_id, void* old_object, void* new_object, DiffContext& context)
+		{
+			const PatchPlan* plan = get_plan(type_id);
+			if (plan == nullptr) {
+				return false;
+			}
+
+			switch (plan->kind) {
+			case PlanKind::Unsupported:
+				assert(!"The type has no fields, container or comparison operator to diff with.");
+				return false;
+			case PlanKind::Bytes:
+				if (std::memcmp(old_object, new_object, plan->size) != 0) {
+					write_assign(context, new_object, plan->size);
+				}
+				return true;
+			case PlanKind::Members:
+				return diff_members(*plan, type_id, old_object, new_object, context);
+			case PlanKind::Sequence:
+				return diff_sequences(*plan, old_object, new_object, context);
+			case PlanKind::Pointer:
+				return diff_pointers(*plan, old_object, new_object, context);
+			case PlanKind::Compared:
+				return deep_equal(AnyPtr{ old_object, type_id }, AnyPtr{ new_object, type_id });
+			}
+
+			return false;
+		}
+
+		// Patching
+		// ===========================================================================
+
+		class PatchReader
+		{
+		public:
+			explicit PatchReader(std::span<const std::byte> patch)
+				: patch(patch)
+			{
+			}
+
+			bool at_end() const { return position == patch.size(); }
+
+			template<typename T>
+			bool read(T& value)
+			{
+				if (patch.size() - position < sizeof(T)) {
+					return false;
+				}
+
+				std::memcpy(&value, patch.data() + position, sizeof(T));
+				position += sizeof(T);
+				return true;
+			}
+
+			const std::byte* read_bytes(size_t size)
+			{
+				if (patch.size() - position < size) {
+					return nullptr;
+				}
+
+				const std::byte* bytes = patch.data() + position;
+				position += size;
+				return bytes;
+			}
+
+		private:
+			std::span<const std::byte> patch;
+			size_t position = 0;
+		};
+
+		// The object a change applies to, and how many bytes may be assigned to it.
+		struct PatchTarget
+		{
+			void* object;
+			TemplateTypeId type_id;
+			const PatchPlan* plan;
+			size_t assignable_size; // The rest of the run for bytes members
+		};
+
+		bool step_into(PatchTarget& target, uint32_t path_element)
+		{
+			const PatchPlan& plan = *target.plan;
+			std::optional<size_t> run_size;
+
+			switch (plan.kind) {
+			case PlanKind::Members: {
+				if (path_element >= plan.members.size()) {
+					return false;
+				}
+
+				const PatchMember& member = plan.members[path_element];
+				switch (member.kind) {
+				case PatchMember::Kind::Bytes:
+					run_size = member.run_end - member.offset;
+					target.object = offset_by(target.object, member.offset);
+					break;
+				case PatchMember::Kind::Member:
+					target.object = offset_by(target.object, member.offset);
+					break;
+				case PatchMember::Kind::IndirectMember:
+					target.object = member.get_address(AnyPtr{ target.object, target.type_id }).value_ptr;
+					break;
+				case PatchMember::Kind::Base:
+					if (member.upcast == nullptr) {
+						return false;
+					}
+					target.object = member.upcast(AnyPtr{ target.object, target.type_id }).value_ptr;
+					break;
+				}
+				target.type_id = member.type_id;
+				break;
+			}
+			case PlanKind::Sequence:
+				if (path_element >= plan.sequence->size(target.object)) {
+					return false;
+				}
+				target.object = plan.sequence->at(target.object, path_element);
+				target.type_id = plan.element_type;
+				break;
+			case PlanKind::Pointer: {
+				const AnyPtr pointee = plan.pointer->get(target.object);
+				if (path_element != c_patch_pointee || pointee.value_ptr == nullptr) {
+					return false;
+				}
+				target.object = pointee.value_ptr;
+				target.type_id = pointee.type_id;
+				break;
+			}
+			default:
+				return false;
+			}
+
+			target.plan = get_plan(target.type_id);
+			if (target.plan == nullptr) {
+				return false;
+			}
+			target.assignable_size = run_size.value_or(target.plan->kind == PlanKind::Bytes ? target.plan->size : 0);
+			return true;
+		}
+
+		bool is_valid_payload(const PatchPlan& plan, TemplateTypeId type_id, const std::byte* bytes, size_t size)
+		{
+			if (plan.is_bool) {
+				return size == sizeof(bool) && (bytes[0] == std::byte{ 0 } || bytes[0] == std::byte{ 1 });
+			}
+			if (plan.is_enum) {
+				const Enum* enumeration = get_enum(type_id);
+				if (enumeration == nullptr || size != plan.size) {
+					return false;
+				}
+
+				// An enumerator, or a combination of flag enumerators
+				const int64_t value = enumeration->get_value(AnyConstRef{ bytes, type_id });
+				int64_t remaining_bits = 0;
+				if (enumeration->to_name(value).empty()) {
+					enumeration->decompose(value, &remaining_bits);
+				}
+				return remaining_bits == 0;
+			}
+
+			return true;
+		}
+
+		bool apply_assign(const PatchTarget& target, PatchReader& reader)
+		{
+			uint32_t size = 0;
+			const std::byte* bytes = reader.read(size) ? reader.read_bytes(size) : nullptr;
+			if (bytes == nullptr) {
+				return false;
+			}
+
+			const PatchPlan& plan = *target.plan;
+			if (plan.kind == PlanKind::Sequence && plan.elements_are_bytes) {
+				const SequenceOperations& sequence = *plan.sequence;
+				if (size % sequence.element_size != 0) {
+					return false;
+				}
+
+				const size_t count = size / sequence.element_size;
+				if (count != sequence.size(target.object)) {
+					if (sequence.resize == nullptr) {
+						return false;
+					}
+					sequence.resize(target.object, count);
+				}
+				if (size != 0) {
+					std::memcpy(sequence.data(target.object), bytes, size);
+				}
+				return true;
+			}
+
+			if (size == 0 || size > target.assignable_size || !is_valid_payload(plan, target.type_id, bytes, size)) {
+				return false;
+			}
+			std::memcpy(target.object, bytes, size);
+			return true;
+		}
+
+		bool apply_change(AnyPtr object, PatchReader& reader)
+		{
+			Patch::Op op{};
+			uint8_t depth = 0;
+			if (!reader.read(op) || !reader.read(depth) || op > Patch::Op::Reset) {
+				return false;
+			}
+
+			PatchTarget target{ object.value_ptr, object.type_id, get_plan(object.type_id), 0 };
+			if (target.plan == nullptr) {
+				return false;
+			}
+			target.assignable_size = target.plan->kind == PlanKind::Bytes ? target.plan->size : 0;
+
+			for (uint8_t i = 0; i < depth; ++i) {
+				uint32_t path_element = 0;
+				if (!reader.read(path_element) || !step_into(target, path_element)) {
+					return false;
+				}
+			}
+
+			const PatchPlan& plan = *target.plan;
+			switch (op) {
+			case Patch::Op::Assign:
+				return apply_assign(target, reader);
+			case Patch::Op::Resize: {
+				uint32_t size = 0;
+				if (!reader.read(size) || plan.kind != PlanKind::Sequence || plan.sequence->resize == nullptr) {
+					return false;
+				}
+				// The size comes from the patch, don't let it allocate without bounds
+				if (size > plan.sequence->size(target.object) && size > c_max_patch_sequence_bytes / std::max<size_t>(plan.sequence->element_size, 1)) {
+					return false;
+				}
+				plan.sequence->resize(target.object, size);
+				return true;
+			}
+			case Patch::Op::Emplace:
+				if (plan.kind != PlanKind::Pointer || plan.pointer->emplace == nullptr) {
+					return false;
+				}
+				plan.pointer->emplace(target.object);
+				return true;
+			case Patch::Op::Reset:
+				if (plan.kind != PlanKind::Pointer) {
+					return false;
+				}
+				plan.pointer->reset(target.object);
+				return true;
+			}
+
+			return false;
+		}
+	}
+
+	bool diff(AnyPtr old_object, AnyPtr new_object, Patch& patch)
+	{
+		patch.data.clear();
+		if (old_object.type_id != new_object.type_id) {
+			assert(!"Only objects of the same type can be diffed.");
+			return false;
+		}
+
+		DiffContext context{ patch.data, {} };
+		return diff(old_object.type_id, old_object.value_ptr, new_object.value_ptr, context);
+	}
+
+	bool apply_patch(AnyPtr object, std::span<const std::byte> patch)
+	{
+		PatchReader reader{ patch };
+		while (!reader.at_end()) {
+			if (!apply_change(object, reader)) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,321 @@
+#include "neat/Enum.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+
+
+namespace Neat
+{
+	struct EnumContainer
+	{
+		struct string_hash : std::hash<std::string_view> 
+		{
+			using is_transparent = std::true_type;
+		};
+
+		std::unordered_map<std::string, uint32_t, string_hash, std::equal_to<>> by_enum_name;
+		std::unordered_map<TemplateTypeId, uint32_t> by_template_type_id;
+		std::vector<Enum> enums;
+	};
+	static EnumContainer enum_container;
+
+
+	Enum& add_enum(Enum&& enum_)
+	{
+		auto enum_by_id_it = enum_container.by_template_type_id.find(enum_.id());
+		if (enum_by_id_it != enum_container.by_template_type_id.end())
+		{
+			return enum_container.enums[enum_by_id_it->second];
+		}
+
+		enum_container.by_enum_name[enum_.name()] = enum_container.enums.size();
+		enum_container.by_template_type_id[enum_.id()] = enum_container.enums.size();
+		enum_container.enums.push_back(std::move(enum_));
+		return enum_container.enums.back();
+	}
+
+	std::span<const Enum> get_enums()
+	{
+		return { enum_container.enums.begin(), enum_container.enums.end() };
+	}
+
+	const Enum* get_enum(std::string_view enum_name)
+	{
+		auto it = enum_container.by_enum_name.find(enum_name);
+		if (it != enum_container.by_enum_name.end())
+		{
+			return &enum_container.enums[it->second];
+		}
+		return nullptr;
+	}
+
+	const Enum* get_enum(TemplateTypeId type_id)
+	{
+		auto it = enum_container.by_template_type_id.find(type_id);
+		if (it != enum_container.by_template_type_id.end())
+		{
+			return &enum_container.enums[it->second];
+		}
+		return nullptr;
+	}
+
+
+	namespace
+	{
+		// Use a dense table when at most this many slots are wasted per enumerator.
+		constexpr uint64_t c_max_dense_slots_per_enumerator = 4;
+		constexpr uint64_t c_min_dense_slots = 64;
+
+		uint64_t mix(uint64_t hash)
+		{
+			// Finaliser of MurmurHash3, spreads the FNV-1a bits so the low bits can be used as an index.
+			hash ^= hash >> 33;
+			hash *= 0xff51afd7ed558ccdull;
+			hash ^= hash >> 33;
+			hash *= 0xc4ceb9fe1a85ec53ull;
+			hash ^= hash >> 33;
+			return hash;
+		}
+
+		uint64_t hash_name(std::string_view name, uint64_t seed)
+		{
+			// 64 bit FNV-1a
+			uint64_t hash = 14695981039346656037ull ^ (seed * 0x9e3779b97f4a7c15ull);
+			for (char c : name) {
+				hash ^= static_cast<unsigned char>(c);
+				hash *= 1099511628211ull;
+			}
+
+			return mix(hash);
+		}
+
+		std::string_view trim(std::string_view text)
+		{
+			while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) { text.remove_prefix(1); }
+			while (!text.empty() && (text.back() == ' ' || text.back() == '\t')) { text.remove_suffix(1); }
+			return text;
+		}
+	}
+
+	Enum::Enum(std::string name, TemplateTypeId id, TemplateTypeId underlying_type, size_t size, bool is_signed, std::vector<Enumerator> enumerators)
+		: enum_name(std::move(name))
+		, type_id(id)
+		, underlying_type_id(underlying_type)
+		, value_size(size)
+		, is_signed(is_signed)
+		, enumerator_list(std::move(enumerators))
+	{
+		build_value_lookup();
+		build_name_lookup();
+	}
+
+	void Enum::build_value_lookup()
+	{
+		if (enumerator_list.empty()) {
+			return;
+		}
+
+		auto [min_it, max_it] = std::minmax_element(enumerator_list.begin(), enumerator_list.end(),
+			[](const Enumerator& a, const Enumerator& b) { return a.value < b.value; });
+		const uint64_t range = static_cast<uint64_t>(max_it->value) - static_cast<uint64_t>(min_it->value);
+
+		if (range < std::max(c_min_dense_slots, c_max_dense_slots_per_enumerator * enumerator_list.size())) {
+			min_value = min_it->value;
+			dense_indices.assign(range + 1, -1);
+
+			// Iterate backwards, so the first enumerator with a value wins
+			for (size_t i = enumerator_list.size(); i-- > 0;) {
+				dense_indices[static_cast<uint64_t>(enumerator_list[i].value) - static_cast<uint64_t>(min_value)] = static_cast<int32_t>(i);
+			}
+			return;
+		}
+
+		sorted_values.reserve(enumerator_list.size());
+		for (uint32_t i = 0; i < enumerator_list.size(); ++i) {
+			sorted_values.emplace_back(enumerator_list[i].value, i);
+		}
+		std::stable_sort(sorted_values.begin(), sorted_values.end(),
+			[](const auto& a, const auto& b) { return a.first < b.first; });
+	}
+
+	void Enum::build_name_lookup()
+	{
+		const size_t count = enumerator_list.size();
+		if (count == 0) {
+			return;
+		}
+
+		// Hash and displace: names are split into buckets by a first hash,
+		// then every bucket searches a seed which puts all its names in empty slots.
+		const size_t bucket_count = std::max<size_t>(1, count / 2);
+		const size_t slot_count = std::bit_ceil(count);
+
+		std::vector<std::vector<uint32_t>> buckets(bucket_count);
+		for (uint32_t i = 0; i < count; ++i) {
+			buckets[hash_name(enumerator_list[i].name, 0) % bucket_count].push_back(i);
+		}
+
+		std::vector<uint32_t> bucket_order(bucket_count);
+		for (uint32_t i = 0; i < bucket_count; ++i) {
+			bucket_order[i] = i;
+		}
+		std::sort(bucket_order.begin(), bucket_order.end(), [&buckets](uint32_t a, uint32_t b) { return buckets[a].size() > buckets[b].size(); });
+
+		bucket_seeds.assign(bucket_count, 0);
+		name_slots.assign(slot_count, -1);
+
+		std::vector<size_t> candidate_slots;
+		for (uint32_t bucket_index : bucket_order) {
+			const auto& bucket = buckets[bucket_index];
+			if (bucket.empty()) {
+				break;
+			}
+
+			for (uint32_t seed = 1;; ++seed) {
+				candidate_slots.clear();
+
+				bool fits = true;
+				for (uint32_t enumerator_index : bucket) {
+					const size_t slot = hash_name(enumerator_list[enumerator_index].name, seed) & (slot_count - 1);
+					if (name_slots[slot] != -1 || std::find(candidate_slots.begin(), candidate_slots.end(), slot) != candidate_slots.end()) {
+						fits = false;
+						break;
+					}
+					candidate_slots.push_back(slot);
+				}
+
+				if (fits) {
+					for (size_t i = 0; i < bucket.size(); ++i) {
+						name_slots[candidate_slots[i]] = static_cast<int32_t>(bucket[i]);
+					}
+					bucket_seeds[bucket_index] = seed;
+					break;
+				}
+			}
+		}
+	}
+
+	uint32_t Enum::find_name_slot(std::string_view name) const
+	{
+		const uint32_t seed = bucket_seeds[hash_name(name, 0) % bucket_seeds.size()];
+		return static_cast<uint32_t>(hash_name(name, seed) & (name_slots.size() - 1));
+	}
+
+	std::string_view Enum::to_name(int64_t value) const
+	{
+		if (!dense_indices.empty()) {
+			const uint64_t index = static_cast<uint64_t>(value) - static_cast<uint64_t>(min_value);
+			if (index >= dense_indices.size() || dense_indices[index] == -1) {
+				return {};
+			}
+			return enumerator_list[dense_indices[index]].name;
+		}
+
+		auto it = std::lower_bound(sorted_values.begin(), sorted_values.end(), value,
+			[](const auto& entry, int64_t value) { return entry.first < value; });
+		if (it == sorted_values.end() || it->first != value) {
+			return {};
+		}
+		return enumerator_list[it->second].name;
+	}
+
+	std::optional<int64_t> Enum::to_value(std::string_view name) const
+	{
+		if (name_slots.empty()) {
+			return std::nullopt;
+		}
+
+		const int32_t index = name_slots[find_name_slot(name)];
+		if (index == -1 || enumerator_list[index].name != name) {
+			return std::nullopt;
+		}
+		return enumerator_list[index].value;
+	}
+
+	std::vector<std::string_view> Enum::decompose(int64_t value, int64_t* out_remaining_bits) const
+	{
+		std::vector<const Enumerator*> candidates;
+		for (const Enumerator& enumerator : enumerator_list) {
+			if (enumerator.value != 0) {
+				candidates.push_back(&enumerator);
+			}
+		}
+		std::stable_sort(candidates.begin(), candidates.end(), [](const Enumerator* a, const Enumerator* b) {
+			return std::popcount(static_cast<uint64_t>(a->value)) > std::popcount(static_cast<uint64_t>(b->value));
+		});
+
+		const uint64_t bits = static_cast<uint64_t>(value);
+		uint64_t remaining = bits;
+		std::vector<std::string_view> names;
+		for (const Enumerator* enumerator : candidates) {
+			const uint64_t enumerator_bits = static_cast<uint64_t>(enumerator->value);
+			if ((bits & enumerator_bits) == enumerator_bits && (remaining & enumerator_bits) != 0) {
+				names.push_back(enumerator->name);
+				remaining &= ~enumerator_bits;
+			}
+		}
+
+		if (out_remaining_bits) {
+			*out_remaining_bits = static_cast<int64_t>(remaining);
+		}
+		return names;
+	}
+
+	std::optional<int64_t> Enum::compose(std::string_view names, char separator) const
+	{
+		uint64_t bits = 0;
+
+		while (true) {
+			const size_t separator_position = names.find(separator);
+			const std::string_view name = trim(names.substr(0, separator_position));
+
+			if (!name.empty()) {
+				auto value = to_value(name);
+				if (!value) {
+					return std::nullopt;
+				}
+				bits |= static_cast<uint64_t>(*value);
+			}
+
+			if (separator_position == std::string_view::npos) {
+				break;
+			}
+			names.remove_prefix(separator_position + 1);
+		}
+
+		return static_cast<int64_t>(bits);
+	}
+
+	int64_t Enum::get_value(AnyConstRef value) const
+	{
+		assert(value.type_id == type_id);
+
+		switch (value_size) {
+		case 1: { int8_t v; std::memcpy(&v, value.value_ptr, 1); return is_signed ? int64_t(v) : int64_t(uint8_t(v)); }
+		case 2: { int16_t v; std::memcpy(&v, value.value_ptr, 2); return is_signed ? int64_t(v) : int64_t(uint16_t(v)); }
+		case 4: { int32_t v; std::memcpy(&v, value.value_ptr, 4); return is_signed ? int64_t(v) : int64_t(uint32_t(v)); }
+		case 8: { int64_t v; std::memcpy(&v, value.value_ptr, 8); return v; }
+		}
+
+		assert(false && "Unsupported enum size.");
+		return 0;
+	}
+
+	void Enum::set_value(AnyRef value, int64_t new_value) const
+	{
+		assert(value.type_id == type_id);
+
+		switch (value_size) {
+		case 1: { int8_t v = int8_t(new_value); std::memcpy(value.value_ptr, &v, 1); return; }
+		case 2: { int16_t v = int16_t(new_value); std::memcpy(value.value_ptr, &v, 2); return; }
+		case 4: { int32_t v = int32_t(new_value); std::memcpy(value.value_ptr, &v, 4); return; }
+		case 8: { std::memcpy(value.value_ptr, &new_value, 8); return; }
+		}
+
+		assert(false && "Unsupported enum size.");
+	}
+}
@@ -0,0 +1,226 @@
+#include "neat/FieldGather.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#if defined(_M_X64) || defined(__x86_64__)
+	#define NEAT_GATHER_AVX2 1
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+		#define NEAT_TARGET_AVX2
+	#else
+		#define NEAT_TARGET_AVX2 __attribute__((target("avx2")))
+	#endif
+#else
+	#define NEAT_GATHER_AVX2 0
+#endif
+
+
+namespace Neat
+{
+	namespace
+	{
+		// Scalar kernels, the size is a template argument so the memcpy becomes a single load and store.
+		template<size_t TSize>
+		void gather_fixed(const std::byte* first, size_t stride, size_t count, std::byte* out)
+		{
+			for (size_t i = 0; i < count; ++i) {
+				std::memcpy(out + i * TSize, first + i * stride, TSize);
+			}
+		}
+
+		template<size_t TSize>
+		void scatter_fixed(std::byte* first, size_t stride, size_t count, const std::byte* values)
+		{
+			for (size_t i = 0; i < count; ++i) {
+				std::memcpy(first + i * stride, values + i * TSize, TSize);
+			}
+		}
+
+		void gather_bytes(const std::byte* first, size_t stride, size_t count, size_t size, std::byte* out)
+		{
+			switch (size) {
+			case 1: gather_fixed<1>(first, stride, count, out); return;
+			case 2: gather_fixed<2>(first, stride, count, out); return;
+			case 4: gather_fixed<4>(first, stride, count, out); return;
+			case 8: gather_fixed<8>(first, stride, count, out); return;
+			case 16: gather_fixed<16>(first, stride, count, out); return;
+			}
+
+			for (size_t i = 0; i < count; ++i) {
+				std::memcpy(out + i * size, first + i * stride, size);
+			}
+		}
+
+		void scatter_bytes(std::byte* first, size_t stride, size_t count, size_t size, const std::byte* values)
+		{
+			switch (size) {
+			case 1: scatter_fixed<1>(first, stride, count, values); return;
+			case 2: scatter_fixed<2>(first, stride, count, values); return;
+			case 4: scatter_fixed<4>(first, stride, count, values); return;
+			case 8: scatter_fixed<8>(first, stride, count, values); return;
+			case 16: scatter_fixed<16>(first, stride, count, values); return;
+			}
+
+			for (size_t i = 0; i < count; ++i) {
+				std::memcpy(first + i * stride, values + i * size, size);
+			}
+		}
+
+#if NEAT_GATHER_AVX2
+		bool cpu_supports_avx2()
+		{
+#if defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 0);
+			if (info[0] < 7) {
+				return false;
+			}
+
+			// The OS needs to save the ymm registers
+			__cpuid(info, 1);
+			const bool os_saves_ymm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+
+			__cpuidex(info, 7, 0);
+			return os_saves_ymm && (info[1] & (1 << 5)) != 0;
+#else
+			return __builtin_cpu_supports("avx2");
+#endif
+		}
+
+		const bool c_has_avx2 = cpu_supports_avx2();
+
+		// The gather indices are relative to the first object of each block, so 7 strides need to fit in an int32.
+		bool fits_gather_indices(size_t stride)
+		{
+			return stride <= size_t(std::numeric_limits<int32_t>::max()) / 7;
+		}
+
+		NEAT_TARGET_AVX2 void gather_32_avx2(const std::byte* first, size_t stride, size_t count, std::byte* out)
+		{
+			const __m256i indices = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(int32_t(stride)));
+
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8) {
+				const __m256i values = _mm256_i32gather_epi32(reinterpret_cast<const int*>(first + i * stride), indices, 1);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 4), values);
+			}
+
+			gather_fixed<4>(first + i * stride, stride, count - i, out + i * 4);
+		}
+
+		NEAT_TARGET_AVX2 void gather_64_avx2(const std::byte* first, size_t stride, size_t count, std::byte* out)
+		{
+			const __m128i indices = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(int32_t(stride)));
+
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4) {
+				const __m256i values = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(first + i * stride), indices, 1);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 8), values);
+			}
+
+			gather_fixed<8>(first + i * stride, stride, count - i, out + i * 8);
+		}
+#endif
+
+		std::byte* object_at(AnyPtr objects, size_t stride, size_t index)
+		{
+			return static_cast<std::byte*>(objects.value_ptr) + index * stride;
+		}
+
+		void* field_at(const Field& field, AnyPtr objects, size_t stride, size_t index)
+		{
+			return field.get_address(AnyPtr{ object_at(objects, stride, index), objects.type_id }).value_ptr;
+		}
+
+		const Type& get_field_type(const Field& field)
+		{
+			const Type* type = get_type(field.type);
+			assert(type != nullptr && "Fields which aren't trivially copyable need their type to be registered.");
+			return *type;
+		}
+	}
+
+	void gather_strided(const void* first, size_t stride, size_t count, size_t size, void* out)
+	{
+#if NEAT_GATHER_AVX2
+		if (c_has_avx2 && fits_gather_indices(stride)) {
+			if (size == 4) {
+				gather_32_avx2(static_cast<const std::byte*>(first), stride, count, static_cast<std::byte*>(out));
+				return;
+			}
+			if (size == 8) {
+				gather_64_avx2(static_cast<const std::byte*>(first), stride, count, static_cast<std::byte*>(out));
+				return;
+			}
+		}
+#endif
+
+		gather_bytes(static_cast<const std::byte*>(first), stride, count, size, static_cast<std::byte*>(out));
+	}
+
+	void scatter_strided(void* first, size_t stride, size_t count, size_t size, const void* values)
+	{
+		// AVX2 has no scatter instruction, strided stores are done with the scalar kernels.
+		scatter_bytes(static_cast<std::byte*>(first), stride, count, size, static_cast<const std::byte*>(values));
+	}
+
+	void gather(const Field& field, AnyPtr objects, size_t stride, size_t count, void* out)
+	{
+		assert(objects.type_id == field.object_type);
+		if (count == 0) {
+			return;
+		}
+
+		std::byte* out_bytes = static_cast<std::byte*>(out);
+
+		if (has_flags(field.type_flags, TypeFlags::TriviallyCopyable)) {
+			if (field.offset.has_value()) {
+				gather_strided(object_at(objects, stride, 0) + *field.offset, stride, count, field.size, out_bytes);
+				return;
+			}
+
+			for (size_t i = 0; i < count; ++i) {
+				std::memcpy(out_bytes + i * field.size, field_at(field, objects, stride, i), field.size);
+			}
+			return;
+		}
+
+		const Type& type = get_field_type(field);
+		assert(type.copy_n != nullptr && "Field type isn't copy constructible.");
+		for (size_t i = 0; i < count; ++i) {
+			type.copy_n(AnyPtr{ out_bytes + i * field.size, field.type }, AnyPtr{ field_at(field, objects, stride, i), field.type }, 1);
+		}
+	}
+
+	void scatter(const Field& field, AnyPtr objects, size_t stride, size_t count, const void* values)
+	{
+		assert(objects.type_id == field.object_type);
+		if (count == 0) {
+			return;
+		}
+
+		const std::byte* value_bytes = static_cast<const std::byte*>(values);
+
+		if (has_flags(field.type_flags, TypeFlags::TriviallyCopyable)) {
+			if (field.offset.has_value()) {
+				scatter_strided(object_at(objects, stride, 0) + *field.offset, stride, count, field.size, value_bytes);
+				return;
+			}
+
+			for (size_t i = 0; i < count; ++i) {
+				std::memcpy(field_at(field, objects, stride, i), value_bytes + i * field.size, field.size);
+			}
+			return;
+		}
+
+		const Type& type = get_field_type(field);
+		assert(type.copy_assign_n != nullptr && "Field type isn't copy assignable.");
+		for (size_t i = 0; i < count; ++i) {
+			type.copy_assign_n(AnyPtr{ field_at(field, objects, stride, i), field.type }, AnyPtr{ const_cast<std::byte*>(value_bytes + i * field.size), field.type }, 1);
+		}
+	}
+}
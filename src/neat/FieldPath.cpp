@@ -0,0 +1,191 @@
+#include "neat/FieldPath.h"
+#include "neat/FieldGather.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+
+namespace Neat
+{
+	namespace
+	{
+		const Field* find_field(const Type& type, std::string_view name)
+		{
+			auto it = std::find_if(type.fields.begin(), type.fields.end(), [name](const Field& field) { return field.name == name; });
+			return it != type.fields.end() ? &*it : nullptr;
+		}
+	}
+
+	FieldPath FieldPath::compile(const Type& type, std::string_view path)
+	{
+		FieldPath field_path{};
+		const Type* current_type = &type;
+
+		while (true) {
+			const size_t separator = path.find('.');
+			const std::string_view name = path.substr(0, separator);
+
+			const Field* field = find_field(*current_type, name);
+			if (field == nullptr) {
+				return {};
+			}
+
+			// Last field
+			if (separator == std::string_view::npos) {
+				field_path.leaf_offset = field->offset;
+				field_path.leaf_get_address = field->get_address;
+				field_path.leaf_get_value = field->get_value;
+				field_path.leaf_set_value = field->set_value;
+				field_path.leaf_object_type_id = field->object_type;
+				field_path.leaf_type_id = field->type;
+				field_path.leaf_size = field->size;
+				field_path.leaf_type_flags = field->type_flags;
+				break;
+			}
+
+			// Intermediate field
+			if (field->offset.has_value()) {
+				field_path.parent_offset += *field->offset;
+			} else {
+				field_path.parent_hops.push_back(Hop{ field_path.parent_offset, field->get_address, field->object_type });
+				field_path.parent_offset = 0;
+			}
+
+			current_type = get_type(field->type);
+			if (current_type == nullptr) {
+				return {};
+			}
+
+			path.remove_prefix(separator + 1);
+		}
+
+		if (field_path.parent_hops.empty() && field_path.leaf_offset.has_value()) {
+			field_path.total_offset = field_path.parent_offset + *field_path.leaf_offset;
+		}
+
+		field_path.object_type_id = type.id;
+		return field_path;
+	}
+
+	FieldPath FieldPath::compile(TemplateTypeId type_id, std::string_view path)
+	{
+		const Type* type = get_type(type_id);
+		if (type == nullptr) {
+			return {};
+		}
+
+		return compile(*type, path);
+	}
+
+	void* FieldPath::resolve_parent(void* object) const
+	{
+		std::byte* address = static_cast<std::byte*>(object);
+		for (const Hop& hop : parent_hops) {
+			address = static_cast<std::byte*>(hop.get_address(AnyPtr{ address + hop.offset_before, hop.object_type }).value_ptr);
+		}
+
+		return address + parent_offset;
+	}
+
+	void* FieldPath::resolve_address(void* object) const
+	{
+		if (total_offset.has_value()) {
+			return static_cast<std::byte*>(object) + *total_offset;
+		}
+
+		void* parent = resolve_parent(object);
+		if (leaf_offset.has_value()) {
+			return static_cast<std::byte*>(parent) + *leaf_offset;
+		}
+
+		return leaf_get_address(AnyPtr{ parent, leaf_object_type_id }).value_ptr;
+	}
+
+	AnyRef FieldPath::resolve(AnyRef object) const
+	{
+		assert(is_valid());
+		assert(object.type_id == object_type_id);
+
+		return AnyRef{ resolve_address(object.value_ptr), leaf_type_id };
+	}
+
+	AnyConstRef FieldPath::resolve(AnyConstRef object) const
+	{
+		// Resolving only computes addresses, so it's safe to do on a const object.
+		AnyRef field = resolve(AnyRef{ const_cast<void*>(object.value_ptr), object.type_id });
+		return AnyConstRef{ field.value_ptr, field.type_id };
+	}
+
+	Any FieldPath::get_value(AnyPtr object) const
+	{
+		assert(is_valid());
+		assert(object.type_id == object_type_id);
+		assert(leaf_get_value != nullptr && "Can't copy the field's value.");
+
+		return leaf_get_value(AnyPtr{ resolve_parent(object.value_ptr), leaf_object_type_id });
+	}
+
+	void FieldPath::set_value(AnyPtr object, Any value) const
+	{
+		assert(is_valid());
+		assert(object.type_id == object_type_id);
+		assert(leaf_set_value != nullptr && "Can't set a const field.");
+
+		leaf_set_value(AnyPtr{ resolve_parent(object.value_ptr), leaf_object_type_id }, std::move(value));
+	}
+
+	void FieldPath::gather(AnyPtr objects, size_t stride, size_t count, void* out) const
+	{
+		assert(is_valid());
+		assert(objects.type_id == object_type_id);
+
+		const bool trivially_copyable = has_flags(leaf_type_flags, TypeFlags::TriviallyCopyable);
+		std::byte* object_bytes = static_cast<std::byte*>(objects.value_ptr);
+		std::byte* out_bytes = static_cast<std::byte*>(out);
+
+		if (trivially_copyable && total_offset.has_value()) {
+			gather_strided(object_bytes + *total_offset, stride, count, leaf_size, out_bytes);
+			return;
+		}
+
+		const Type* type = trivially_copyable ? nullptr : get_type(leaf_type_id);
+		assert((trivially_copyable || (type != nullptr && type->copy_n != nullptr)) && "Field type needs to be registered and copy constructible.");
+
+		for (size_t i = 0; i < count; ++i) {
+			void* source = resolve_address(object_bytes + i * stride);
+			if (trivially_copyable) {
+				std::memcpy(out_bytes + i * leaf_size, source, leaf_size);
+			} else {
+				type->copy_n(AnyPtr{ out_bytes + i * leaf_size, leaf_type_id }, AnyPtr{ source, leaf_type_id }, 1);
+			}
+		}
+	}
+
+	void FieldPath::scatter(AnyPtr objects, size_t stride, size_t count, const void* values) const
+	{
+		assert(is_valid());
+		assert(objects.type_id == object_type_id);
+
+		const bool trivially_copyable = has_flags(leaf_type_flags, TypeFlags::TriviallyCopyable);
+		std::byte* object_bytes = static_cast<std::byte*>(objects.value_ptr);
+		const std::byte* value_bytes = static_cast<const std::byte*>(values);
+
+		if (trivially_copyable && total_offset.has_value()) {
+			scatter_strided(object_bytes + *total_offset, stride, count, leaf_size, value_bytes);
+			return;
+		}
+
+		const Type* type = trivially_copyable ? nullptr : get_type(leaf_type_id);
+		assert((trivially_copyable || (type != nullptr && type->copy_assign_n != nullptr)) && "Field type needs to be registered and copy assignable.");
+
+		for (size_t i = 0; i < count; ++i) {
+			void* destination = resolve_address(object_bytes + i * stride);
+			if (trivially_copyable) {
+				std::memcpy(destination, value_bytes + i * leaf_size, leaf_size);
+			} else {
+				type->copy_assign_n(AnyPtr{ destination, leaf_type_id }, AnyPtr{ const_cast<std::byte*>(value_bytes + i * leaf_size), leaf_type_id }, 1);
+			}
+		}
+	}
+}
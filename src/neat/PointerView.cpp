@@ -0,0 +1,16 @@
+#include "neat/PointerView.h"
+#include "neat/Reflection.h"
+
+
+namespace Neat
+{
+	PointerView PointerView::create(AnyPtr pointer)
+	{
+		const Type* type = get_type(pointer.type_id);
+		if (type == nullptr || type->pointer_operations == nullptr) {
+			return PointerView{};
+		}
+
+		return PointerView{ pointer, *type->pointer_operations };
+	}
+}
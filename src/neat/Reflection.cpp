@@ -1,9 +1,11 @@
 #include "neat/Reflection.h"
 
 #include <unordered_map>
+#include <typeindex>
 #include <vector>
 #include <string>
 #include <functional>
+#include <utility>
 #include <cassert>
 
 
@@ -18,10 +20,91 @@ namespace Neat
 
 		std::unordered_map<std::string, uint32_t, string_hash, std::equal_to<>> by_type_name;
 		std::unordered_map<TemplateTypeId, uint32_t> by_template_type_id;
+		std::unordered_map<StableTypeId, uint32_t> by_stable_type_id;
+		std::unordered_map<std::type_index, uint32_t> by_type_info; // Only polymorphic types
 		std::vector<Type> types;
+
+		// Indexed by TemplateTypeId, so validating a versioned id is a single load. Manual ids above the limit use `by_template_type_id`.
+		static constexpr TemplateTypeId c_dense_id_limit = 1 << 16;
+		std::vector<VersionedTypeId> dense_versioned_ids;
 	};
 	static TypeContainer type_container;
 
+	static VersionedTypeId make_versioned_id(const Type& type)
+	{
+		return VersionedTypeId::create(type.id, type.generation, type.module_tag);
+	}
+
+	static void update_versioned_id(const Type& type)
+	{
+		if (type.id >= TypeContainer::c_dense_id_limit)
+		{
+			return;
+		}
+
+		if (type.id >= type_container.dense_versioned_ids.size())
+		{
+			type_container.dense_versioned_ids.resize(type.id + 1);
+		}
+		type_container.dense_versioned_ids[type.id] = make_versioned_id(type);
+	}
+
+	// Functions and variables, indexed by qualified name. Overloads share a name, all of them are kept in the order they were added.
+	template<typename T>
+	struct NamedContainer
+	{
+		struct string_hash : std::hash<std::string_view> 
+		{
+			using is_transparent = std::true_type;
+		};
+
+		T& add(T&& value)
+		{
+			// Registering the same entry again (e.g. a module's registration running twice) returns the existing one
+			std::vector<uint32_t>& indices = by_name[value.name];
+			for (uint32_t index : indices)
+			{
+				if (values[index] == value)
+				{
+					return values[index];
+				}
+			}
+
+			indices.push_back(values.size());
+			values.push_back(std::move(value));
+			return values.back();
+		}
+
+		const T* get(std::string_view name) const
+		{
+			auto it = by_name.find(name);
+			if (it != by_name.end())
+			{
+				return &values[it->second.front()];
+			}
+			return nullptr;
+		}
+
+		std::vector<const T*> get_all(std::string_view name) const
+		{
+			std::vector<const T*> found;
+			auto it = by_name.find(name);
+			if (it != by_name.end())
+			{
+				for (uint32_t index : it->second)
+				{
+					found.push_back(&values[index]);
+				}
+			}
+			return found;
+		}
+
+		std::unordered_map<std::string, std::vector<uint32_t>, string_hash, std::equal_to<>> by_name;
+		std::vector<T> values;
+	};
+	static NamedContainer<Function> function_container;
+	static NamedContainer<Variable> variable_container;
+
 
 	Type& add_type(Type&& type)
 	{
@@ -31,12 +114,111 @@ namespace Neat
 			return type_container.types[type_by_id_it->second];
 		}
 
+		const StableTypeId stable_id = std::exchange(type.stable_id, c_empty_stable_type_id);
+
 		type_container.by_type_name[type.name] = type_container.types.size();
 		type_container.by_template_type_id[type.id] = type_container.types.size();
+		if (type.type_info != nullptr)
+		{
+			type_container.by_type_info[*type.type_info] = type_container.types.size();
+		}
 		type_container.types.push_back(std::move(type));
+		update_versioned_id(type_container.types.back());
+
+		if (stable_id != c_empty_stable_type_id)
+		{
+			set_stable_id(type_container.types.back().id, stable_id);
+		}
+
 		return type_container.types.back();
 	}
 
+	Type& replace_type(Type&& type)
+	{
+		auto type_by_id_it = type_container.by_template_type_id.find(type.id);
+		if (type_by_id_it == type_container.by_template_type_id.end())
+		{
+			return add_type(std::move(type));
+		}
+
+		const uint32_t index = type_by_id_it->second;
+		Type& old_type = type_container.types[index];
+
+		if (old_type.name != type.name)
+		{
+			type_container.by_type_name.erase(old_type.name);
+			type_container.by_type_name[type.name] = index;
+		}
+
+		// Keep the registered stable id unless the new type brings its own
+		StableTypeId stable_id = std::exchange(type.stable_id, old_type.stable_id);
+		type.generation = TypeGeneration(old_type.generation + 1);
+
+		if (old_type.type_info != nullptr && (type.type_info == nullptr || *old_type.type_info != *type.type_info))
+		{
+			type_container.by_type_info.erase(*old_type.type_info);
+		}
+		if (type.type_info != nullptr)
+		{
+			type_container.by_type_info[*type.type_info] = index;
+		}
+
+		old_type = std::move(type);
+		update_versioned_id(old_type);
+
+		if (stable_id != c_empty_stable_type_id && stable_id != old_type.stable_id)
+		{
+			// The old id stays mapped if the new one collides, so the type can still be found by it
+			const StableTypeId old_stable_id = old_type.stable_id;
+			if (set_stable_id(old_type.id, stable_id) && old_stable_id != c_empty_stable_type_id)
+			{
+				type_container.by_stable_type_id.erase(old_stable_id);
+			}
+		}
+
+		return old_type;
+	}
+
+	void invalidate_module(ModuleTag module_tag)
+	{
+		assert(module_tag != c_empty_module_tag && "Types without a module tag can't be invalidated.");
+
+		for (Type& type : type_container.types)
+		{
+			if (type.module_tag == module_tag)
+			{
+				++type.generation;
+				update_versioned_id(type);
+			}
+		}
+	}
+
+	VersionedTypeId get_versioned_id(TemplateTypeId type_id)
+	{
+		if (type_id < type_container.dense_versioned_ids.size())
+		{
+			return type_container.dense_versioned_ids[type_id];
+		}
+
+		if (type_id < TypeContainer::c_dense_id_limit)
+		{
+			return VersionedTypeId{};
+		}
+
+		const Type* type = get_type(type_id);
+		return type != nullptr ? make_versioned_id(*type) : VersionedTypeId{};
+	}
+
+	bool is_current(VersionedTypeId versioned_id)
+	{
+		return !versioned_id.is_empty() && get_versioned_id(versioned_id.index()) == versioned_id;
+	}
+
+	const Type* get_type(VersionedTypeId versioned_id)
+	{
+		return is_current(versioned_id) ? get_type(versioned_id.index()) : nullptr;
+	}
+
 	std::span<const Type> get_types()
 	{
 		return { type_container.types.begin(), type_container.types.end() };
@@ -61,4 +243,89 @@ namespace Neat
 		}
 		return nullptr;
 	}
+
+	const Type* get_type(const std::type_info& type_info)
+	{
+		auto it = type_container.by_type_info.find(type_info);
+		if (it != type_container.by_type_info.end())
+		{
+			return &type_container.types[it->second];
+		}
+		return nullptr;
+	}
+
+	namespace Detail
+	{
+		TemplateTypeId get_registered_type_id(const std::type_info& type_info)
+		{
+			const Type* type = get_type(type_info);
+			return type != nullptr ? type->id : c_empty_type_id;
+		}
+	}
+
+	bool set_stable_id(TemplateTypeId type_id, StableTypeId stable_id)
+	{
+		auto type_by_id_it = type_container.by_template_type_id.find(type_id);
+		assert(type_by_id_it != type_container.by_template_type_id.end() && "The type needs to be added before it gets a stable id.");
+		if (type_by_id_it == type_container.by_template_type_id.end())
+		{
+			return false;
+		}
+
+		auto [it, inserted] = type_container.by_stable_type_id.try_emplace(stable_id, type_by_id_it->second);
+		if (!inserted && it->second != type_by_id_it->second)
+		{
+			// Stable ids end up in saved data, this needs a rename before it silently loads the wrong type.
+			assert(false && "Stable type id collision, two types have the same stable id.");
+			return false;
+		}
+
+		type_container.types[type_by_id_it->second].stable_id = stable_id;
+		return true;
+	}
+
+	const Type* get_type_by_stable_id(StableTypeId stable_id)
+	{
+		auto it = type_container.by_stable_type_id.find(stable_id);
+		if (it != type_container.by_stable_type_id.end())
+		{
+			return &type_container.types[it->second];
+		}
+		return nullptr;
+	}
+
+	Function& add_function(Function&& function)
+	{
+		return function_container.add(std::move(function));
+	}
+
+	std::span<const Function> get_functions()
+	{
+		return { function_container.values.begin(), function_container.values.end() };
+	}
+
+	const Function* get_function(std::string_view qualified_name)
+	{
+		return function_container.get(qualified_name);
+	}
+
+	std::vector<const Function*> get_functions(std::string_view qualified_name)
+	{
+		return function_container.get_all(qualified_name);
+	}
+
+	Variable& add_variable(Variable&& variable)
+	{
+		return variable_container.add(std::move(variable));
+	}
+
+	std::span<const Variable> get_variables()
+	{
+		return { variable_container.values.begin(), variable_container.values.end() };
+	}
+
+	const Variable* get_variable(std::string_view qualified_name)
+	{
+		return variable_container.get(qualified_name);
+	}
 }
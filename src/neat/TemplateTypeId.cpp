@@ -7,8 +7,23 @@ namespace Neat
 {
 	TemplateTypeId generate_new_type_id()
 	{
-		// Reserve id 0 for invalid id's.
-		static constinit std::atomic<TemplateTypeId> id_counter = 1;
+		// Reserve id 0 for invalid id's, and the ids below `c_first_generated_type_id` for fixed ids.
+		static constinit std::atomic<TemplateTypeId> id_counter = c_first_generated_type_id;
 		return id_counter.fetch_add(1, std::memory_order_relaxed);
 	}
+
+	namespace Detail
+	{
+		TemplateTypeId assign_type_id(TemplateTypeId& id_slot)
+		{
+			// Only the first thread's id is kept, the others read it back. Losing the race wastes an id, which is fine.
+			TemplateTypeId expected = c_empty_type_id;
+			const TemplateTypeId new_id = generate_new_type_id();
+			if (std::atomic_ref<TemplateTypeId>{ id_slot }.compare_exchange_strong(expected, new_id, std::memory_order_relaxed)) {
+				return new_id;
+			}
+
+			return expected;
+		}
+	}
 }
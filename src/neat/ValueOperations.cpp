@@ -0,0 +1,23 @@
+#include "neat/ValueOperations.h"
+
+#include <cstdint>
+
+
+namespace Neat
+{
+	size_t hash_bytes(const void* data, size_t size)
+	{
+		// 64 bit FNV-1a
+		constexpr uint64_t c_offset_basis = 14695981039346656037ull;
+		constexpr uint64_t c_prime = 1099511628211ull;
+
+		const auto* bytes = static_cast<const unsigned char*>(data);
+		uint64_t hash = c_offset_basis;
+		for (size_t i = 0; i < size; ++i) {
+			hash ^= bytes[i];
+			hash *= c_prime;
+		}
+
+		return static_cast<size_t>(hash);
+	}
+}
@@ -10,6 +10,11 @@ namespace Namespace {
 	export void NamespacedFunction() {}
 }
 
+export int multiply(int a, int b) { return a * b; }
+export double multiply(double a, double b) { return a * b; }
+
+export int module_counter = 3;
+
 export struct MyBaseStruct { int health; };
 
 export struct MyStruct : MyBaseStruct
@@ -22,6 +27,8 @@ export struct MyStruct : MyBaseStruct
 	int get_42();
 };
 
+export class PrivatelyDerivedClass : MyBaseStruct {};
+
 class NonExportedClass {};
 
 export class MyClass 
@@ -53,6 +60,18 @@ public:
 	int TestMethodReturn();
 	constexpr static int test_method_const_return_value = 51;
 	int TestMethodConstReturn() const;
+
+	static int twice(int i) { return i * 2; }
+	static inline int instance_count = 0;
+};
+
+export enum class Colour { Red = 1, Green = 2, Blue = 4 };
+
+export struct EnumTester
+{
+	enum Mode { Idle, Running = 5 };
+	Mode mode = Idle;
+	Colour colour = Colour::Green;
 };
 
 export class ClassWithUnreflectedPrivates
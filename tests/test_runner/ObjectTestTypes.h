@@ -0,0 +1,41 @@
+// Types shared by the tests which walk whole objects (`deep_equal`, `clone`, `diff`), and their registration.
+#pragma once
+#include "neat/Reflection.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+struct ObjectTestPacked
+{
+	int a = 1;
+	int b = 2;
+};
+
+struct ObjectTestBase
+{
+	int base_value = 0;
+};
+
+// Registers the types above, the fundamental types and the containers of them the tests use as members.
+inline void register_object_test_types()
+{
+	Neat::add_type(Neat::Type::create<bool>("bool", Neat::get_id<bool>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<char>("char", Neat::get_id<char>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<int>("int", Neat::get_id<int>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<double>("double", Neat::get_id<double>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<std::string>("std::string", Neat::get_id<std::string>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<ObjectTestPacked>("ObjectTestPacked", Neat::get_id<ObjectTestPacked>(), {}, {
+			Neat::Field::create<ObjectTestPacked, int, &ObjectTestPacked::a>("a", Neat::Access::Public),
+			Neat::Field::create<ObjectTestPacked, int, &ObjectTestPacked::b>("b", Neat::Access::Public),
+		}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<ObjectTestBase>("ObjectTestBase", Neat::get_id<ObjectTestBase>(), {}, {
+			Neat::Field::create<ObjectTestBase, int, &ObjectTestBase::base_value>("base_value", Neat::Access::Public),
+		}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<ObjectTestPacked*>("ObjectTestPacked*", Neat::get_id<ObjectTestPacked*>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<std::vector<ObjectTestPacked>>("std::vector<ObjectTestPacked>", Neat::get_id<std::vector<ObjectTestPacked>>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<std::unique_ptr<ObjectTestPacked>>("std::unique_ptr<ObjectTestPacked>", Neat::get_id<std::unique_ptr<ObjectTestPacked>>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<std::map<std::string, int>>("std::map<std::string, int>", Neat::get_id<std::map<std::string, int>>(), {}, {}, {}, {}, {}));
+}
@@ -0,0 +1,88 @@
+#include "catch2/catch_all.hpp"
+#include "neat/Any.h"
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+
+struct AnyComparisonBitwiseType
+{
+	int a;
+	int b;
+};
+
+struct AnyComparisonNotComparableType
+{
+	double value;
+};
+
+struct AnyComparisonNotComparableElement {};
+
+TEST_CASE("Any operator==")
+{
+	using namespace std::string_literals;
+
+	CHECK(Neat::Any{} == Neat::Any{});
+	CHECK(Neat::Any{ 5 } == Neat::Any{ 5 });
+	CHECK(Neat::Any{ 5 } != Neat::Any{ 6 });
+	CHECK(Neat::Any{ 5 } != Neat::Any{});
+	CHECK(Neat::Any{ 5 } != Neat::Any{ 5u }); // Different types are never equal
+
+	CHECK(Neat::Any{ "Hello"s } == Neat::Any{ "Hello"s });
+	CHECK(Neat::Any{ "Hello"s } != Neat::Any{ "World"s });
+
+	CHECK(Neat::Any{ 0.0 } == Neat::Any{ -0.0 }); // Floats don't take the memcmp path
+
+	CHECK(Neat::Any{ AnyComparisonBitwiseType{ 1, 2 } } == Neat::Any{ AnyComparisonBitwiseType{ 1, 2 } });
+	CHECK(Neat::Any{ AnyComparisonBitwiseType{ 1, 2 } } != Neat::Any{ AnyComparisonBitwiseType{ 1, 3 } });
+}
+
+TEST_CASE("Any operator== on types without comparison")
+{
+	Neat::Any a{ AnyComparisonNotComparableType{ 1.0 } };
+	Neat::Any b{ AnyComparisonNotComparableType{ 1.0 } };
+
+	CHECK(a == a);
+	CHECK(a != b); // Only equal to itself
+
+	// Containers of non comparable types must still be storable
+	Neat::Any vector{ std::vector<AnyComparisonNotComparableElement>{} };
+	CHECK(vector == vector);
+}
+
+TEST_CASE("Any operator<=>")
+{
+	using namespace std::string_literals;
+
+	CHECK((Neat::Any{ 1 } <=> Neat::Any{ 2 }) == std::partial_ordering::less);
+	CHECK((Neat::Any{ 2 } <=> Neat::Any{ 1 }) == std::partial_ordering::greater);
+	CHECK((Neat::Any{ 2 } <=> Neat::Any{ 2 }) == std::partial_ordering::equivalent);
+	CHECK((Neat::Any{ "a"s } <=> Neat::Any{ "b"s }) == std::partial_ordering::less);
+
+	auto expected_type_order = (Neat::get_id<int>() <=> Neat::get_id<double>());
+	CHECK((Neat::Any{ 1 } <=> Neat::Any{ 1.0 }) == expected_type_order);
+
+	CHECK((Neat::Any{ AnyComparisonNotComparableType{ 1.0 } } <=> Neat::Any{ AnyComparisonNotComparableType{ 1.0 } }) == std::partial_ordering::unordered);
+}
+
+TEST_CASE("Test std::hash<Neat::Any>")
+{
+	using namespace std::string_literals;
+	std::hash<Neat::Any> hasher{};
+
+	CHECK(hasher(Neat::Any{ 5 }) == hasher(Neat::Any{ 5 }));
+	CHECK(hasher(Neat::Any{ "Hello"s }) == std::hash<std::string>{}("Hello"s));
+	CHECK(hasher(Neat::Any{ AnyComparisonBitwiseType{ 1, 2 } }) == hasher(Neat::Any{ AnyComparisonBitwiseType{ 1, 2 } }));
+
+	std::unordered_map<Neat::Any, int> cache{};
+	cache[Neat::Any{ 5 }] = 1;
+	cache[Neat::Any{ "Hello"s }] = 2;
+	cache[Neat::Any{ 5.0 }] = 3;
+
+	CHECK(cache.size() == 3);
+	CHECK(cache.at(Neat::Any{ 5 }) == 1);
+	CHECK(cache.at(Neat::Any{ "Hello"s }) == 2);
+	CHECK(cache.at(Neat::Any{ 5.0 }) == 3);
+	CHECK(!cache.contains(Neat::Any{ 6 }));
+}
@@ -0,0 +1,117 @@
+#include "catch2/catch_all.hpp"
+#include "neat/Reflection.h"
+#include "neat/FieldHandle.h"
+#include "neat/FieldPath.h"
+
+#include <string>
+#include <type_traits>
+
+
+struct AnyRefTestType
+{
+	int counter;
+	std::string label;
+};
+
+static Neat::Field create_any_ref_label_field()
+{
+	return Neat::Field::create<AnyRefTestType, std::string, &AnyRefTestType::label>("label", Neat::Access::Public);
+}
+
+TEST_CASE("AnyRef typed accessors")
+{
+	int value = 5;
+	Neat::AnyRef ref{ value };
+
+	REQUIRE(ref.has_value());
+	CHECK(ref.type_id == Neat::get_id<int>());
+	CHECK(ref.value_ptr == &value);
+
+	CHECK(ref.get<int>() == 5);
+	CHECK(ref.try_get<int>() == &value);
+	CHECK(ref.try_get<double>() == nullptr);
+
+	ref.get<int>() = 7;
+	CHECK(value == 7);
+
+	Neat::AnyRef empty_ref{};
+	CHECK(!empty_ref.has_value());
+	CHECK(empty_ref.try_get<int>() == nullptr);
+}
+
+TEST_CASE("AnyConstRef typed accessors")
+{
+	const std::string value = "Hello";
+	Neat::AnyConstRef ref{ value };
+
+	REQUIRE(ref.has_value());
+	CHECK(ref.type_id == Neat::get_id<std::string>());
+	CHECK(ref.get<std::string>() == "Hello");
+	CHECK(ref.try_get<std::string>() == &value);
+	CHECK(ref.try_get<int>() == nullptr);
+
+	int mutable_value = 3;
+	Neat::AnyConstRef from_ref{ Neat::AnyRef{ mutable_value } };
+	CHECK(from_ref.get<int>() == 3);
+}
+
+TEST_CASE("AnyRef from Any")
+{
+	Neat::Any value{ std::string{ "Boxed" } };
+
+	Neat::AnyRef ref = value.to_any_ref();
+	REQUIRE(ref.has_value());
+	CHECK(ref.value_ptr == value.value_ptr<std::string>());
+	CHECK(ref.get<std::string>() == "Boxed");
+
+	const Neat::Any& const_value = value;
+	Neat::AnyConstRef const_ref = const_value.to_any_ref();
+	CHECK(const_ref.value_ptr == ref.value_ptr);
+
+	Neat::Any empty{};
+	CHECK(!empty.to_any_ref().has_value());
+}
+
+TEST_CASE("Field::get_ref doesn't copy the field")
+{
+	AnyRefTestType object{ .counter = 1, .label = "A label which is too long for small string optimisation" };
+	auto field = create_any_ref_label_field();
+
+	Neat::AnyRef ref = field.get_ref(Neat::AnyRef{ object });
+	REQUIRE(ref.has_value());
+	CHECK(ref.try_get<std::string>() == &object.label);
+
+	ref.get<std::string>() = "Changed";
+	CHECK(object.label == "Changed");
+
+	const AnyRefTestType& const_object = object;
+	Neat::AnyConstRef const_ref = field.get_ref(Neat::AnyConstRef{ const_object });
+	CHECK(const_ref.try_get<std::string>() == &object.label);
+	CHECK(const_ref.get<std::string>() == "Changed");
+}
+
+TEST_CASE("Objects convert to the reference matching their constness")
+{
+	Neat::add_type(Neat::Type::create<AnyRefTestType>("AnyRefTestType", Neat::get_id<AnyRefTestType>(), {}, { create_any_ref_label_field() }, {}, {}, {}));
+
+	AnyRefTestType object{ .counter = 1, .label = "Label" };
+	const AnyRefTestType& const_object = object;
+	auto field = create_any_ref_label_field();
+
+	static_assert(std::is_same_v<decltype(field.get_ref(object)), Neat::AnyRef>);
+	static_assert(std::is_same_v<decltype(field.get_ref(const_object)), Neat::AnyConstRef>);
+	static_assert(!std::is_convertible_v<const AnyRefTestType&, Neat::AnyRef>);
+	CHECK(field.get_ref(object).try_get<std::string>() == &object.label);
+	CHECK(field.get_ref(const_object).try_get<std::string>() == &object.label);
+
+	auto handle = Neat::FieldHandle<std::string>::create(field);
+	REQUIRE(handle.is_valid());
+	CHECK(&handle.get(object) == &object.label);
+	CHECK(&handle.get(const_object) == &object.label);
+
+	auto path = Neat::FieldPath::compile(Neat::get_id<AnyRefTestType>(), "label");
+	REQUIRE(path.is_valid());
+	static_assert(std::is_same_v<decltype(path.resolve(object)), Neat::AnyRef>);
+	CHECK(path.resolve(object).value_ptr == &object.label);
+	CHECK(path.resolve(const_object).value_ptr == &object.label);
+}
@@ -0,0 +1,142 @@
+#include "catch2/catch_all.hpp"
+#include "neat/AnyVector.h"
+#include "neat/Reflection.h"
+
+#include <string>
+
+
+struct AnyVectorTestType
+{
+	int i = 3;
+	std::string s = "A string which doesn't fit in the small string buffer";
+};
+
+static const Neat::Type& register_any_vector_test_types()
+{
+	Neat::add_type(Neat::Type::create<int>("int", Neat::get_id<int>(), {}, {}, {}, {}, {}));
+	return Neat::add_type(Neat::Type::create<AnyVectorTestType>("AnyVectorTestType", Neat::get_id<AnyVectorTestType>(), {}, {}, {}, {}, {}));
+}
+
+TEST_CASE("AnyVector of trivial types")
+{
+	register_any_vector_test_types();
+
+	Neat::AnyVector vector{ Neat::get_id<int>() };
+	CHECK(vector.type_id() == Neat::get_id<int>());
+	CHECK(vector.stride() == sizeof(int));
+	CHECK(vector.empty());
+
+	for (int i = 0; i < 100; ++i) {
+		vector.push_back(i);
+	}
+
+	REQUIRE(vector.size() == 100);
+	CHECK(vector.capacity() >= 100);
+	CHECK(vector[42].get<int>() == 42);
+
+	auto span = vector.as_span<int>();
+	REQUIRE(span.size() == 100);
+	CHECK(span.data() == vector.data());
+	CHECK(span[99] == 99);
+
+	vector.resize(150);
+	CHECK(vector[149].get<int>() == 0); // Value initialised
+
+	vector.pop_back();
+	CHECK(vector.size() == 149);
+
+	vector.clear();
+	CHECK(vector.empty());
+}
+
+TEST_CASE("AnyVector of non trivial types")
+{
+	const Neat::Type& type = register_any_vector_test_types();
+
+	Neat::AnyVector vector{ type };
+
+	Neat::AnyRef first = vector.emplace_back();
+	REQUIRE(first.try_get<AnyVectorTestType>() != nullptr);
+	CHECK(first.get<AnyVectorTestType>().i == 3);
+
+	// Force a few relocations
+	for (int i = 0; i < 64; ++i) {
+		vector.push_back(AnyVectorTestType{ i, std::to_string(i) });
+	}
+
+	REQUIRE(vector.size() == 65);
+	CHECK(vector[0].get<AnyVectorTestType>().s == "A string which doesn't fit in the small string buffer");
+	CHECK(vector[64].get<AnyVectorTestType>().i == 63);
+	CHECK(vector[64].get<AnyVectorTestType>().s == "63");
+
+	auto* base = static_cast<std::byte*>(vector.data());
+	CHECK(vector[10].value_ptr == base + 10 * sizeof(AnyVectorTestType));
+
+	vector.resize(2);
+	CHECK(vector.size() == 2);
+	CHECK(vector.back().get<AnyVectorTestType>().s == "0");
+}
+
+TEST_CASE("AnyVector move")
+{
+	register_any_vector_test_types();
+
+	Neat::AnyVector vector{ Neat::get_id<AnyVectorTestType>() };
+	vector.emplace_back();
+	const void* data = vector.data();
+
+	Neat::AnyVector moved{ std::move(vector) };
+	CHECK(vector.empty());
+	CHECK(vector.data() == nullptr);
+	REQUIRE(moved.size() == 1);
+	CHECK(moved.data() == data);
+
+	Neat::AnyVector assigned{ Neat::get_id<int>() };
+	assigned = std::move(moved);
+	CHECK(assigned.type_id() == Neat::get_id<AnyVectorTestType>());
+	CHECK(assigned.size() == 1);
+}
+
+TEST_CASE("AnyVector copy")
+{
+	register_any_vector_test_types();
+
+	Neat::AnyVector vector{ Neat::get_id<AnyVectorTestType>() };
+	vector.push_back(AnyVectorTestType{ 1, "One" });
+	vector.push_back(AnyVectorTestType{ 2, "Two" });
+
+	Neat::AnyVector copy{ vector };
+	REQUIRE(copy.size() == 2);
+	CHECK(copy.data() != vector.data());
+	CHECK(copy[1].get<AnyVectorTestType>().s == "Two");
+
+	AnyVectorTestType value{ 3, "Three" };
+	copy.push_back(Neat::AnyConstRef{ value });
+	REQUIRE(copy.size() == 3);
+	CHECK(copy[2].get<AnyVectorTestType>().s == "Three");
+	CHECK(value.s == "Three");
+
+	vector = copy;
+	CHECK(vector.size() == 3);
+	CHECK(vector[0].get<AnyVectorTestType>().s == "One");
+}
+
+TEST_CASE("AnyVector push_back of its own element")
+{
+	register_any_vector_test_types();
+
+	Neat::AnyVector vector{ Neat::get_id<AnyVectorTestType>() };
+	vector.push_back(AnyVectorTestType{ 1, "First, a string which doesn't fit in the small string buffer" });
+
+	// Several of these grow the vector and free the buffer the value lives in
+	for (int i = 0; i < 10; ++i) {
+		vector.push_back(vector[0]);
+		vector.push_back(vector.as_span<AnyVectorTestType>()[vector.size() - 1]);
+	}
+	REQUIRE(vector.size() == 21);
+
+	for (const AnyVectorTestType& element : vector.as_span<AnyVectorTestType>()) {
+		CHECK(element.i == 1);
+		CHECK(element.s == "First, a string which doesn't fit in the small string buffer");
+	}
+}
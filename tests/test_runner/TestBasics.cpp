@@ -1,6 +1,7 @@
 module;
 #include "catch2/catch_all.hpp"
 #include "neat/Reflection.h"
+#include "neat/Enum.h"
 
 #include <string_view>
 #include <string>
@@ -279,4 +280,70 @@ TEST_CASE("Invoke method")
 	REQUIRE(value_int != nullptr);
 
 	REQUIRE(*value_int == 42);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Generated enums")
+{
+	SECTION("Colour") {
+		const Neat::Enum* colour = Neat::get_enum(Neat::get_id<Colour>());
+		REQUIRE(colour != nullptr);
+		CHECK(colour == Neat::get_enum("Colour"));
+		CHECK(Neat::get_type<Colour>() != nullptr);
+
+		CHECK(colour->to_name(Colour::Blue) == "Blue");
+		CHECK(colour->to_value<Colour>("Green") == Colour::Green);
+		CHECK(colour->compose("Red|Blue") == 5);
+	}
+
+	SECTION("EnumTester::Mode") {
+		const Neat::Enum* mode = Neat::get_enum("EnumTester::Mode");
+		REQUIRE(mode != nullptr);
+		CHECK(mode->id() == Neat::get_id<EnumTester::Mode>());
+		CHECK(mode->to_name(EnumTester::Running) == "Running");
+
+		EnumTester tester{};
+		mode->set_value(tester.mode, 5);
+		CHECK(tester.mode == EnumTester::Running);
+	}
+}
+
+TEST_CASE("Generated stable type ids")
+{
+	const Neat::Type* type = Neat::get_type<MyStruct>();
+	REQUIRE(type != nullptr);
+
+#ifdef NEAT_REFLECTION_STABLE_TYPE_IDS
+	// Generated with `--stable-ids`
+	CHECK(type->stable_id == Neat::make_stable_type_id("MyStruct"));
+	CHECK(Neat::get_type_by_stable_id(Neat::make_stable_type_id("MyStruct")) == type);
+	CHECK(Neat::get_type_by_stable_id(Neat::make_stable_type_id("NormalNamespace::NotExportedClass")) == Neat::get_type("NormalNamespace::NotExportedClass"));
+	CHECK(Neat::get_type<Colour>()->stable_id == Neat::make_stable_type_id("Colour"));
+#else
+	CHECK(type->stable_id == Neat::c_empty_stable_type_id);
+#endif
+}
+
+TEST_CASE("Generated base classes upcast")
+{
+	SECTION("Public base") {
+		MyStruct my_struct{};
+
+		const Neat::Type* type = Neat::get_type<MyStruct>();
+		REQUIRE(type != nullptr);
+		REQUIRE(type->bases.size() == 1);
+		REQUIRE(type->bases[0].upcast != nullptr);
+
+		Neat::AnyPtr base = type->bases[0].upcast({ &my_struct, type->id });
+		CHECK(base.value_ptr == static_cast<MyBaseStruct*>(&my_struct));
+		CHECK(base.type_id == Neat::get_id<MyBaseStruct>());
+	}
+
+	SECTION("Private base") {
+		const Neat::Type* type = Neat::get_type<PrivatelyDerivedClass>();
+		REQUIRE(type != nullptr);
+
+		const std::vector<Neat::BaseClass> type_expected_bases{ { Neat::get_id<MyBaseStruct>(), Neat::Access::Private } };
+		REQUIRE(type->bases == type_expected_bases);
+		CHECK(type->bases[0].upcast == nullptr); // The generated code can't cast to it
+	}
+}
@@ -0,0 +1,140 @@
+#include "catch2/catch_all.hpp"
+#include "neat/ChangeTracking.h"
+#include "neat/FieldHandle.h"
+#include "neat/Reflection.h"
+
+#include <string>
+#include <vector>
+
+
+struct ChangeTrackingTestType
+{
+	int health = 100;
+	float speed = 1.0f;
+	std::string name;
+};
+
+static const Neat::Type& register_change_tracking_test_type()
+{
+	Neat::add_type(Neat::Type::create<ChangeTrackingTestType>("ChangeTrackingTestType", Neat::get_id<ChangeTrackingTestType>(), {}, {
+			Neat::Field::create<ChangeTrackingTestType, int, &ChangeTrackingTestType::health>("health", Neat::Access::Public),
+			Neat::Field::create<ChangeTrackingTestType, float, &ChangeTrackingTestType::speed>("speed", Neat::Access::Public),
+			Neat::Field::create<ChangeTrackingTestType, std::string, &ChangeTrackingTestType::name>("name", Neat::Access::Public),
+		}, {}, {}, {}));
+	return *Neat::get_type<ChangeTrackingTestType>();
+}
+
+static std::vector<size_t> dirty_indices(const Neat::DirtyFields& dirty_fields)
+{
+	std::vector<size_t> indices;
+	dirty_fields.for_each([&indices](size_t field_index) { indices.push_back(field_index); });
+	return indices;
+}
+
+TEST_CASE("Type::create numbers the fields")
+{
+	const Neat::Type& type = register_change_tracking_test_type();
+	REQUIRE(type.fields.size() == 3);
+	CHECK(type.fields[0].index == 0);
+	CHECK(type.fields[2].index == 2);
+}
+
+TEST_CASE("Writes to tracked objects are recorded")
+{
+	const Neat::Type& type = register_change_tracking_test_type();
+
+	ChangeTrackingTestType object{};
+	const Neat::AnyPtr object_ptr{ &object, Neat::get_id<ChangeTrackingTestType>() };
+	Neat::track_changes(object_ptr);
+	CHECK(Neat::is_tracked(object_ptr));
+	CHECK(!Neat::consume_dirty(object_ptr).any());
+
+	type.fields[2].set_value(object_ptr, Neat::Any{ std::string{ "Sprinter" } });
+	Neat::FieldHandle<int>::create(type.fields[0]).set(object, 50);
+	Neat::FieldHandle<int>::create(type.fields[0]).set(object, 40);
+	CHECK(object.name == "Sprinter");
+	CHECK(object.health == 40);
+
+	const Neat::DirtyFields dirty_fields = Neat::consume_dirty(object_ptr);
+	CHECK(dirty_fields.count() == 2);
+	CHECK(dirty_fields.test(0));
+	CHECK(!dirty_fields.test(1));
+	CHECK(dirty_indices(dirty_fields) == std::vector<size_t>{ 0, 2 });
+
+	// Consuming clears the dirty fields
+	CHECK(!Neat::consume_dirty(object_ptr).any());
+
+	// Direct writes need to be marked
+	Neat::FieldHandle<float>::create(type.fields[1]).ref(object) = 2.0f;
+	CHECK(!Neat::consume_dirty(object_ptr).any());
+	Neat::mark_dirty(object_ptr, 1);
+	CHECK(dirty_indices(Neat::consume_dirty(object_ptr)) == std::vector<size_t>{ 1 });
+
+	Neat::untrack_changes(object_ptr);
+	CHECK(!Neat::is_tracked(object_ptr));
+	Neat::FieldHandle<float>::create(type.fields[1]).set(object, 4.0f);
+	CHECK(!Neat::consume_dirty(object_ptr).any());
+}
+
+TEST_CASE("Writes to untracked objects are applied but not recorded")
+{
+	const Neat::Type& type = register_change_tracking_test_type();
+
+	ChangeTrackingTestType object{};
+	const Neat::AnyPtr object_ptr{ &object, Neat::get_id<ChangeTrackingTestType>() };
+	type.fields[0].set_value(object_ptr, Neat::Any{ 5 });
+	Neat::FieldHandle<float>::create(type.fields[1]).set(object, 3.0f);
+
+	CHECK(object.health == 5);
+	CHECK(object.speed == 3.0f);
+	CHECK(!Neat::is_tracked(object_ptr));
+	CHECK(!Neat::consume_dirty(object_ptr).any());
+}
+
+TEST_CASE("DirtyFields grows past 64 fields")
+{
+	Neat::DirtyFields dirty_fields{};
+	dirty_fields.set(3);
+	dirty_fields.set(63);
+	dirty_fields.set(64);
+	dirty_fields.set(200);
+
+	CHECK(dirty_fields.count() == 4);
+	CHECK(dirty_fields.test(200));
+	CHECK(!dirty_fields.test(199));
+	CHECK(!dirty_fields.test(1000));
+	CHECK(dirty_indices(dirty_fields) == std::vector<size_t>{ 3, 63, 64, 200 });
+
+	dirty_fields.clear();
+	CHECK(!dirty_fields.any());
+}
+
+struct ChangeTrackingTestDerived : ChangeTrackingTestType
+{
+	int level = 1;
+};
+
+TEST_CASE("Writes to base class fields aren't recorded")
+{
+	register_change_tracking_test_type();
+	Neat::add_type(Neat::Type::create<ChangeTrackingTestDerived>("ChangeTrackingTestDerived", Neat::get_id<ChangeTrackingTestDerived>(),
+		{ Neat::BaseClass::create<ChangeTrackingTestDerived, ChangeTrackingTestType>(Neat::Access::Public) }, {
+			Neat::Field::create<ChangeTrackingTestDerived, int, &ChangeTrackingTestDerived::level>("level", Neat::Access::Public),
+		}, {}, {}, {}));
+	const Neat::Type& type = *Neat::get_type<ChangeTrackingTestDerived>();
+	const Neat::Type& base_type = *Neat::get_type<ChangeTrackingTestType>();
+
+	ChangeTrackingTestDerived object{};
+	const Neat::AnyPtr object_ptr{ &object, Neat::get_id<ChangeTrackingTestDerived>() };
+	Neat::track_changes(object_ptr);
+
+	// The base subobject has the same address, but it's a different object
+	const Neat::AnyPtr base_ptr = type.bases[0].upcast(object_ptr);
+	base_type.fields[0].set_value(base_ptr, Neat::Any{ 10 });
+	CHECK(object.health == 10);
+	CHECK(!Neat::consume_dirty(object_ptr).any());
+
+	type.fields[0].set_value(object_ptr, Neat::Any{ 2 });
+	CHECK(dirty_indices(Neat::consume_dirty(object_ptr)) == std::vector<size_t>{ 0 });
+	Neat::untrack_changes(object_ptr);
+}
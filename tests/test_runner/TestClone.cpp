@@ -0,0 +1,241 @@
+#include "catch2/catch_all.hpp"
+#include "neat/Clone.h"
+#include "neat/Reflection.h"
+#include "ObjectTestTypes.h"
+
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+
+struct CloneTestObject : ObjectTestBase
+{
+	int x = 0;
+	double factor = 1.0;
+	std::string name;
+	std::vector<ObjectTestPacked> items;
+	std::unique_ptr<ObjectTestPacked> owned; // Not copyable, cloned through its pointee
+	ObjectTestPacked* link = nullptr; // Cloned into the arena when there is one
+};
+
+static void register_clone_test_types()
+{
+	register_object_test_types();
+	Neat::add_type(Neat::Type::create<CloneTestObject>("CloneTestObject", Neat::get_id<CloneTestObject>(),
+		{ Neat::BaseClass::create<CloneTestObject, ObjectTestBase>(Neat::Access::Public) }, {
+			Neat::Field::create<CloneTestObject, int, &CloneTestObject::x>("x", Neat::Access::Public),
+			Neat::Field::create<CloneTestObject, double, &CloneTestObject::factor>("factor", Neat::Access::Public),
+			Neat::Field::create<CloneTestObject, std::string, &CloneTestObject::name>("name", Neat::Access::Public),
+			Neat::Field::create<CloneTestObject, std::vector<ObjectTestPacked>, &CloneTestObject::items>("items", Neat::Access::Public),
+			Neat::Field::create<CloneTestObject, std::unique_ptr<ObjectTestPacked>, &CloneTestObject::owned>("owned", Neat::Access::Public),
+			Neat::Field::create<CloneTestObject, ObjectTestPacked*, &CloneTestObject::link>("link", Neat::Access::Public),
+		}, {}, {}, {}));
+}
+
+static Neat::AnyPtr clone_test_ptr(CloneTestObject* object)
+{
+	return Neat::AnyPtr{ object, Neat::get_id<CloneTestObject>() };
+}
+
+TEST_CASE("clone copies fields, bases and owned pointees")
+{
+	register_clone_test_types();
+
+	ObjectTestPacked shared{ 5, 6 };
+	CloneTestObject source{};
+	source.base_value = 7;
+	source.x = 1;
+	source.factor = 0.5;
+	source.name = "A name which doesn't fit in the small string buffer";
+	source.items = { { 1, 2 }, { 3, 4 } };
+	source.owned = std::make_unique<ObjectTestPacked>(ObjectTestPacked{ 8, 9 });
+	source.link = &shared;
+
+	alignas(CloneTestObject) std::byte storage[sizeof(CloneTestObject)];
+	auto* clone = reinterpret_cast<CloneTestObject*>(storage);
+	REQUIRE(Neat::clone(clone_test_ptr(&source), clone_test_ptr(clone)));
+
+	CHECK(clone->base_value == 7);
+	CHECK(clone->x == 1);
+	CHECK(clone->factor == 0.5);
+	CHECK(clone->name == source.name);
+	CHECK(clone->items.size() == 2);
+	CHECK(clone->items[1].b == 4);
+	REQUIRE(clone->owned != nullptr);
+	CHECK(clone->owned != source.owned);
+	CHECK(clone->owned->a == 8);
+	CHECK(clone->owned->b == 9);
+	CHECK(clone->link == &shared); // Without an arena raw pointers are shared
+
+	std::destroy_at(clone);
+}
+
+TEST_CASE("clone allocates raw pointees from the arena")
+{
+	register_clone_test_types();
+
+	ObjectTestPacked shared{ 5, 6 };
+	CloneTestObject source{};
+	source.link = &shared;
+
+	Neat::CloneArena arena{ 64 };
+	alignas(CloneTestObject) std::byte storage[sizeof(CloneTestObject)];
+	auto* clone = reinterpret_cast<CloneTestObject*>(storage);
+	REQUIRE(Neat::clone(clone_test_ptr(&source), clone_test_ptr(clone), &arena));
+
+	REQUIRE(clone->link != nullptr);
+	CHECK(clone->link != &shared);
+	CHECK(clone->link->a == 5);
+	CHECK(clone->link->b == 6);
+	CHECK(clone->owned == nullptr);
+	CHECK(arena.bytes_allocated() == sizeof(ObjectTestPacked));
+
+	std::destroy_at(clone);
+	arena.reset();
+	CHECK(arena.bytes_allocated() == 0);
+}
+
+TEST_CASE("clone_n stamps out copies of a prototype")
+{
+	register_clone_test_types();
+
+	SECTION("Trivially copyable")
+	{
+		ObjectTestPacked prototype{ 3, 4 };
+		std::vector<ObjectTestPacked> copies(100, ObjectTestPacked{ 0, 0 });
+		REQUIRE(Neat::clone_n(Neat::AnyPtr{ &prototype, Neat::get_id<ObjectTestPacked>() }, Neat::AnyPtr{ copies.data(), Neat::get_id<ObjectTestPacked>() }, copies.size()));
+		CHECK(copies.front().a == 3);
+		CHECK(copies.back().b == 4);
+	}
+
+	SECTION("Structured")
+	{
+		CloneTestObject prototype{};
+		prototype.name = "A name which doesn't fit in the small string buffer";
+		prototype.owned = std::make_unique<ObjectTestPacked>();
+
+		constexpr size_t count = 16;
+		auto* copies = static_cast<CloneTestObject*>(::operator new(sizeof(CloneTestObject) * count, std::align_val_t{ alignof(CloneTestObject) }));
+		REQUIRE(Neat::clone_n(clone_test_ptr(&prototype), clone_test_ptr(copies), count));
+
+		for (size_t i = 0; i < count; ++i) {
+			CHECK(copies[i].name == prototype.name);
+			CHECK(copies[i].owned != nullptr);
+		}
+		CHECK(copies[0].owned != copies[1].owned);
+
+		std::destroy_n(copies, count);
+		::operator delete(copies, std::align_val_t{ alignof(CloneTestObject) });
+	}
+}
+
+struct CloneTestNode
+{
+	int value = 0;
+	CloneTestNode* next = nullptr;
+	CloneTestNode* root = nullptr;
+};
+
+TEST_CASE("clone clones each raw pointee once")
+{
+	register_object_test_types();
+	Neat::add_type(Neat::Type::create<CloneTestNode*>("CloneTestNode*", Neat::get_id<CloneTestNode*>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<CloneTestNode>("CloneTestNode", Neat::get_id<CloneTestNode>(), {}, {
+			Neat::Field::create<CloneTestNode, int, &CloneTestNode::value>("value", Neat::Access::Public),
+			Neat::Field::create<CloneTestNode, CloneTestNode*, &CloneTestNode::next>("next", Neat::Access::Public),
+			Neat::Field::create<CloneTestNode, CloneTestNode*, &CloneTestNode::root>("root", Neat::Access::Public),
+		}, {}, {}, {}));
+
+	// A ring of three nodes, each pointing back to the first one
+	CloneTestNode nodes[3];
+	for (int i = 0; i < 3; ++i) {
+		nodes[i].value = i;
+		nodes[i].next = &nodes[(i + 1) % 3];
+		nodes[i].root = &nodes[0];
+	}
+
+	Neat::CloneArena arena{};
+	CloneTestNode clone{};
+	REQUIRE(Neat::clone(Neat::AnyPtr{ &nodes[0], Neat::get_id<CloneTestNode>() }, Neat::AnyPtr{ &clone, Neat::get_id<CloneTestNode>() }, &arena));
+
+	CHECK(arena.bytes_allocated() == 2 * sizeof(CloneTestNode));
+	CHECK(clone.root == &clone);
+	REQUIRE(clone.next != &nodes[1]);
+	CHECK(clone.next->value == 1);
+	CHECK(clone.next->root == &clone);
+	CHECK(clone.next->next->value == 2);
+	CHECK(clone.next->next->next == &clone);
+}
+
+struct CloneTestCopyCounted
+{
+	CloneTestCopyCounted() = default;
+	CloneTestCopyCounted(const CloneTestCopyCounted& other) : name(other.name), copies(other.copies + 1) {}
+	CloneTestCopyCounted& operator=(const CloneTestCopyCounted&) = default;
+
+	std::string name;
+	int copies = 0;
+};
+
+TEST_CASE("clone prefers the copy constructor")
+{
+	register_clone_test_types();
+	Neat::add_type(Neat::Type::create<CloneTestCopyCounted>("CloneTestCopyCounted", Neat::get_id<CloneTestCopyCounted>(), {}, {
+			Neat::Field::create<CloneTestCopyCounted, std::string, &CloneTestCopyCounted::name>("name", Neat::Access::Public),
+			Neat::Field::create<CloneTestCopyCounted, int, &CloneTestCopyCounted::copies>("copies", Neat::Access::Public),
+		}, {}, {}, {}));
+
+	CloneTestCopyCounted source{};
+	source.name = "A name which doesn't fit in the small string buffer";
+	alignas(CloneTestCopyCounted) std::byte storage[sizeof(CloneTestCopyCounted)];
+	auto* clone = reinterpret_cast<CloneTestCopyCounted*>(storage);
+	REQUIRE(Neat::clone(Neat::AnyPtr{ &source, Neat::get_id<CloneTestCopyCounted>() }, Neat::AnyPtr{ clone, Neat::get_id<CloneTestCopyCounted>() }));
+
+	CHECK(clone->name == source.name);
+	CHECK(clone->copies == 1);
+	std::destroy_at(clone);
+}
+
+class CloneTestPrivatelyDerived : ObjectTestBase
+{
+public:
+	explicit CloneTestPrivatelyDerived(int base = 0) { base_value = base; }
+	int base() const { return base_value; }
+
+	std::string name;
+};
+
+class CloneTestPrivatelyDerivedOwner : ObjectTestBase
+{
+public:
+	std::unique_ptr<ObjectTestPacked> owned; // Not copyable, so neither is the class
+};
+
+TEST_CASE("clone doesn't skip bases it can't reach")
+{
+	register_clone_test_types();
+	Neat::add_type(Neat::Type::create<CloneTestPrivatelyDerived>("CloneTestPrivatelyDerived", Neat::get_id<CloneTestPrivatelyDerived>(),
+		{ Neat::BaseClass{ Neat::get_id<ObjectTestBase>(), Neat::Access::Private } }, {
+			Neat::Field::create<CloneTestPrivatelyDerived, std::string, &CloneTestPrivatelyDerived::name>("name", Neat::Access::Public),
+		}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<CloneTestPrivatelyDerivedOwner>("CloneTestPrivatelyDerivedOwner", Neat::get_id<CloneTestPrivatelyDerivedOwner>(),
+		{ Neat::BaseClass{ Neat::get_id<ObjectTestBase>(), Neat::Access::Private } }, {
+			Neat::Field::create<CloneTestPrivatelyDerivedOwner, std::unique_ptr<ObjectTestPacked>, &CloneTestPrivatelyDerivedOwner::owned>("owned", Neat::Access::Public),
+		}, {}, {}, {}));
+
+	// The copy constructor reaches the private base
+	CloneTestPrivatelyDerived source{ 7 };
+	source.name = "Private";
+	alignas(CloneTestPrivatelyDerived) std::byte storage[sizeof(CloneTestPrivatelyDerived)];
+	REQUIRE(Neat::clone({ &source, Neat::get_id<CloneTestPrivatelyDerived>() }, { storage, Neat::get_id<CloneTestPrivatelyDerived>() }));
+	auto* clone = std::launder(reinterpret_cast<CloneTestPrivatelyDerived*>(storage));
+	CHECK(clone->base() == 7);
+	CHECK(clone->name == "Private");
+	std::destroy_at(clone);
+
+	// Without one the base can't be cloned
+	CloneTestPrivatelyDerivedOwner owner{};
+	alignas(CloneTestPrivatelyDerivedOwner) std::byte owner_storage[sizeof(CloneTestPrivatelyDerivedOwner)];
+	CHECK(!Neat::clone({ &owner, Neat::get_id<CloneTestPrivatelyDerivedOwner>() }, { owner_storage, Neat::get_id<CloneTestPrivatelyDerivedOwner>() }));
+}
@@ -0,0 +1,136 @@
+#include "catch2/catch_all.hpp"
+#include "neat/Reflection.h"
+
+#include <array>
+#include <cstddef>
+#include <new>
+#include <string>
+
+
+struct ConstructorTestType
+{
+	ConstructorTestType() = default;
+	ConstructorTestType(int id, const std::string& name) : id(id), name(name) {}
+	explicit ConstructorTestType(std::string&& name) : name(std::move(name)) {}
+	ConstructorTestType(std::string name, double) : name(std::move(name)) {}
+
+	int id = -1;
+	std::string name = "Default";
+};
+
+struct ConstructorTestNonCopyable
+{
+	ConstructorTestNonCopyable() = default;
+	ConstructorTestNonCopyable(const ConstructorTestNonCopyable&) = delete;
+};
+
+struct ConstructorTestAbstract
+{
+	ConstructorTestAbstract(int) {}
+	virtual ~ConstructorTestAbstract() = default;
+	virtual void update() = 0;
+};
+
+static const Neat::Type& register_constructor_test_type()
+{
+	return Neat::add_type(Neat::Type::create<ConstructorTestType>("ConstructorTestType", Neat::get_id<ConstructorTestType>(), {}, {}, {}, {}, {}, {
+			Neat::Constructor::create<ConstructorTestType, int, const std::string&>(Neat::Access::Public),
+			Neat::Constructor::create<ConstructorTestType, std::string&&>(Neat::Access::Public),
+			Neat::Constructor::create<ConstructorTestType, std::string, double>(Neat::Access::Public),
+		}));
+}
+
+TEST_CASE("Reflected constructors")
+{
+	const Neat::Type& type = register_constructor_test_type();
+
+	// The three given constructors, plus the copy and move constructors
+	REQUIRE(type.constructors.size() == 5);
+	CHECK(type.constructors[0].argument_types == std::vector<Neat::TemplateTypeId>{ Neat::get_id<int>(), Neat::get_id<std::string>() });
+	CHECK(type.constructors[0].argument_passing == std::vector<Neat::Passing>{ Neat::Passing::Value, Neat::Passing::ConstLValueReference });
+	CHECK(type.constructors[3].argument_passing == std::vector<Neat::Passing>{ Neat::Passing::ConstLValueReference });
+	CHECK(type.constructors[4].argument_passing == std::vector<Neat::Passing>{ Neat::Passing::RValueReference });
+}
+
+TEST_CASE("Construct in place with arguments")
+{
+	const Neat::Type& type = register_constructor_test_type();
+	alignas(ConstructorTestType) std::byte storage[sizeof(ConstructorTestType)];
+	Neat::AnyPtr object{ storage, type.id };
+
+	int id = 7;
+	std::string name = "A name which doesn't fit in the small string buffer";
+	std::array<Neat::AnyPtr, 2> arguments{ Neat::AnyPtr{ &id, Neat::get_id<int>() }, Neat::AnyPtr{ &name, Neat::get_id<std::string>() } };
+	REQUIRE(type.construct(object, arguments));
+
+	auto* constructed = std::launder(reinterpret_cast<ConstructorTestType*>(storage));
+	CHECK(constructed->id == 7);
+	CHECK(constructed->name == "A name which doesn't fit in the small string buffer");
+	CHECK(name == "A name which doesn't fit in the small string buffer");
+
+	// Copy constructor
+	alignas(ConstructorTestType) std::byte copy_storage[sizeof(ConstructorTestType)];
+	std::array<Neat::AnyPtr, 1> copy_arguments{ Neat::AnyPtr{ constructed, type.id } };
+	REQUIRE(type.construct(Neat::AnyPtr{ copy_storage, type.id }, copy_arguments));
+	auto* copy = std::launder(reinterpret_cast<ConstructorTestType*>(copy_storage));
+	CHECK(copy->id == 7);
+	CHECK(constructed->name == copy->name);
+
+	type.destructor(Neat::AnyPtr{ copy, type.id });
+	type.destructor(object);
+}
+
+TEST_CASE("Construct in place only moves when allowed")
+{
+	const Neat::Type& type = register_constructor_test_type();
+	alignas(ConstructorTestType) std::byte storage[sizeof(ConstructorTestType)];
+	Neat::AnyPtr object{ storage, type.id };
+
+	// By value parameters copy the caller's value
+	std::string name = "A name which doesn't fit in the small string buffer";
+	double unused = 0.0;
+	std::array<Neat::AnyPtr, 2> arguments{ Neat::AnyPtr{ &name, Neat::get_id<std::string>() }, Neat::AnyPtr{ &unused, Neat::get_id<double>() } };
+	REQUIRE(type.construct(object, arguments));
+	CHECK(std::launder(reinterpret_cast<ConstructorTestType*>(storage))->name == name);
+	CHECK(name == "A name which doesn't fit in the small string buffer");
+	type.destructor(object);
+
+	// The only single string constructor takes a rvalue reference
+	std::array<Neat::AnyPtr, 1> move_arguments{ Neat::AnyPtr{ &name, Neat::get_id<std::string>() } };
+	CHECK(!type.construct(object, move_arguments));
+	CHECK(name == "A name which doesn't fit in the small string buffer");
+
+	REQUIRE(type.construct(object, move_arguments, true));
+	CHECK(std::launder(reinterpret_cast<ConstructorTestType*>(storage))->name == "A name which doesn't fit in the small string buffer");
+	CHECK(name.empty());
+	type.destructor(object);
+}
+
+TEST_CASE("Construct in place without a matching constructor")
+{
+	const Neat::Type& type = register_constructor_test_type();
+	alignas(ConstructorTestType) std::byte storage[sizeof(ConstructorTestType)];
+	Neat::AnyPtr object{ storage, type.id };
+
+	double not_an_argument = 1.0;
+	std::array<Neat::AnyPtr, 1> arguments{ Neat::AnyPtr{ &not_an_argument, Neat::get_id<double>() } };
+	CHECK(!type.construct(object, arguments));
+
+	// No arguments falls back to the default constructor
+	REQUIRE(type.construct(object, {}));
+	CHECK(std::launder(reinterpret_cast<ConstructorTestType*>(storage))->name == "Default");
+	type.destructor(object);
+}
+
+TEST_CASE("Constructors which can't be called aren't constructed with")
+{
+	// Deleted constructors and constructors of abstract classes can still be registered
+	auto deleted = Neat::Constructor::create<ConstructorTestNonCopyable, const ConstructorTestNonCopyable&>(Neat::Access::Public);
+	CHECK(deleted.construct == nullptr);
+	auto abstract = Neat::Constructor::create<ConstructorTestAbstract, int>(Neat::Access::Public);
+	CHECK(abstract.construct == nullptr);
+
+	ConstructorTestNonCopyable source{};
+	std::array<Neat::AnyPtr, 1> arguments{ Neat::AnyPtr{ &source, Neat::get_id<ConstructorTestNonCopyable>() } };
+	CHECK(!deleted.accepts(arguments));
+}
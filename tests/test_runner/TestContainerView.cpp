@@ -0,0 +1,138 @@
+#include "catch2/catch_all.hpp"
+#include "neat/ContainerView.h"
+#include "neat/Reflection.h"
+
+#include <array>
+#include <deque>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+TEST_CASE("Container types are recognised")
+{
+	CHECK(Neat::get_sequence_operations<std::vector<int>>() != nullptr);
+	CHECK(Neat::get_sequence_operations<std::array<float, 3>>() != nullptr);
+	CHECK(Neat::get_sequence_operations<std::deque<int>>() != nullptr);
+	CHECK(Neat::get_sequence_operations<std::string>() != nullptr);
+	CHECK(Neat::get_sequence_operations<int[4]>() != nullptr);
+	CHECK(Neat::get_sequence_operations<std::vector<bool>>() == nullptr);
+	CHECK(Neat::get_sequence_operations<int>() == nullptr);
+	CHECK(Neat::get_sequence_operations<std::map<int, int>>() == nullptr);
+
+	CHECK(Neat::get_map_operations<std::map<std::string, int>>() != nullptr);
+	CHECK(Neat::get_map_operations<std::unordered_map<int, double>>() != nullptr);
+	CHECK(Neat::get_map_operations<std::vector<int>>() == nullptr);
+
+	const Neat::Type& type = Neat::add_type(Neat::Type::create<std::vector<int>>("std::vector<int>", Neat::get_id<std::vector<int>>(), {}, {}, {}, {}, {}));
+	CHECK(type.sequence_operations == &Neat::sequence_operations_v<std::vector<int>>);
+	CHECK(type.map_operations == nullptr);
+}
+
+TEST_CASE("SequenceView over a vector")
+{
+	Neat::add_type(Neat::Type::create<std::vector<int>>("std::vector<int>", Neat::get_id<std::vector<int>>(), {}, {}, {}, {}, {}));
+
+	std::vector<int> ids{ 3, 5, 7 };
+	auto view = Neat::SequenceView::create(Neat::AnyPtr{ &ids, Neat::get_id<std::vector<int>>() });
+	REQUIRE(view.is_valid());
+	CHECK(view.element_type() == Neat::get_id<int>());
+	CHECK(view.size() == 3);
+	CHECK(view.is_contiguous());
+	CHECK(view.data() == ids.data());
+	CHECK(view[1].get<int>() == 5);
+
+	int eleven = 11;
+	view.push_back(Neat::AnyConstRef{ eleven });
+	CHECK(ids.back() == 11);
+
+	view[0].get<int>() = 2;
+	CHECK(ids.front() == 2);
+
+	const int bulk[] = { 1, 2, 3, 4, 5 };
+	CHECK(view.assign(bulk, 5));
+	CHECK(ids == std::vector<int>{ 1, 2, 3, 4, 5 });
+
+	view.clear();
+	CHECK(view.empty());
+
+	CHECK(!Neat::SequenceView::create(Neat::AnyPtr{ &ids, Neat::get_id<int>() }).is_valid());
+}
+
+TEST_CASE("SequenceView over other sequences")
+{
+	std::deque<std::string> items{ "Bucket", "Battery" };
+	auto items_view = Neat::SequenceView::create(items);
+	CHECK(!items_view.is_contiguous());
+	CHECK(items_view.data() == nullptr);
+	CHECK(items_view[1].get<std::string>() == "Battery");
+
+	const std::string elements[] = { "Shovel" };
+	CHECK(items_view.assign(elements, 1));
+	REQUIRE(items.size() == 1);
+	CHECK(items[0] == "Shovel");
+
+	int array[4] = { 1, 2, 3, 4 };
+	auto array_view = Neat::SequenceView::create(array);
+	CHECK(array_view.size() == 4);
+	CHECK(!array_view.is_resizable());
+	CHECK(array_view[3].get<int>() == 4);
+
+	const int replacement[] = { 5, 6, 7, 8 };
+	CHECK(array_view.assign(replacement, 4));
+	CHECK(array[0] == 5);
+	CHECK(!array_view.assign(replacement, 2));
+
+	// Fixed size sequences of non trivially copyable elements are assigned element by element
+	Neat::add_type(Neat::Type::create<std::string>("std::string", Neat::get_id<std::string>(), {}, {}, {}, {}, {}));
+	std::array<std::string, 2> names{ "Bucket", "Battery" };
+	auto names_view = Neat::SequenceView::create(names);
+	const std::string new_names[] = { "A name which doesn't fit in the small string buffer", "Shovel" };
+	CHECK(names_view.assign(new_names, 2));
+	CHECK(names[0] == "A name which doesn't fit in the small string buffer");
+	CHECK(names[1] == "Shovel");
+	CHECK(!names_view.assign(new_names, 1));
+
+	std::string text = "abc";
+	auto string_view = Neat::SequenceView::create(text);
+	CHECK(string_view.element_type() == Neat::get_id<char>());
+	string_view.push_back(Neat::AnyConstRef{ 'd' });
+	CHECK(text == "abcd");
+}
+
+TEST_CASE("MapView")
+{
+	std::map<std::string, int> health{ { "player", 100 } };
+	auto view = Neat::MapView::create(health);
+	REQUIRE(view.is_valid());
+	CHECK(view.key_type() == Neat::get_id<std::string>());
+	CHECK(view.mapped_type() == Neat::get_id<int>());
+	CHECK(view.size() == 1);
+
+	const std::string player = "player";
+	const std::string enemy = "enemy";
+	REQUIRE(view.find(Neat::AnyConstRef{ player }).has_value());
+	CHECK(view.find(Neat::AnyConstRef{ player }).get<int>() == 100);
+	CHECK(!view.find(Neat::AnyConstRef{ enemy }).has_value());
+
+	const int fifty = 50;
+	view.insert(Neat::AnyConstRef{ enemy }, Neat::AnyConstRef{ fifty });
+	CHECK(health["enemy"] == 50);
+
+	int total = 0;
+	view.for_each([&](Neat::AnyConstRef key, Neat::AnyRef value) {
+		CHECK(key.type_id == Neat::get_id<std::string>());
+		total += value.get<int>();
+	});
+	CHECK(total == 150);
+
+	CHECK(view.erase(Neat::AnyConstRef{ player }));
+	CHECK(!view.erase(Neat::AnyConstRef{ player }));
+	CHECK(health.size() == 1);
+
+	std::unordered_map<int, double> factors{};
+	auto unordered_view = Neat::MapView::create(factors);
+	unordered_view.reserve(16);
+	CHECK(factors.bucket_count() >= 16);
+}
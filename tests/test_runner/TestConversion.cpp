@@ -0,0 +1,107 @@
+#include "catch2/catch_all.hpp"
+#include "neat/Conversion.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+
+struct ConversionTestCelsius { double degrees; };
+struct ConversionTestFahrenheit { double degrees; };
+
+static Neat::Any celsius_to_fahrenheit(Neat::AnyConstRef value)
+{
+	return ConversionTestFahrenheit{ value.get<ConversionTestCelsius>().degrees * 9.0 / 5.0 + 32.0 };
+}
+
+TEST_CASE("Convert numeric types")
+{
+	auto widened = Neat::convert(Neat::Any{ 5 }, Neat::get_id<int64_t>());
+	REQUIRE(widened.type_id() == Neat::get_id<int64_t>());
+	CHECK(widened.value<int64_t>() == 5);
+
+	auto narrowed = Neat::convert(Neat::Any{ int64_t{ 7 } }, Neat::get_id<int>());
+	REQUIRE(narrowed.type_id() == Neat::get_id<int>());
+	CHECK(narrowed.value<int>() == 7);
+
+	auto to_float = Neat::convert(Neat::Any{ 3 }, Neat::get_id<float>());
+	REQUIRE(to_float.type_id() == Neat::get_id<float>());
+	CHECK(to_float.value<float>() == Catch::Approx(3.0));
+
+	auto to_bool = Neat::convert(Neat::Any{ 2u }, Neat::get_id<bool>());
+	REQUIRE(to_bool.type_id() == Neat::get_id<bool>());
+	CHECK(to_bool.value<bool>() == true);
+
+	auto same_type = Neat::convert(Neat::Any{ 9 }, Neat::get_id<int>());
+	REQUIRE(same_type.type_id() == Neat::get_id<int>());
+	CHECK(same_type.value<int>() == 9);
+}
+
+TEST_CASE("Convert floating point values which don't fit into the integer")
+{
+	auto truncated = Neat::convert(Neat::Any{ -2.75 }, Neat::get_id<int>());
+	REQUIRE(truncated.type_id() == Neat::get_id<int>());
+	CHECK(truncated.value<int>() == -2);
+
+	auto largest = Neat::convert(Neat::Any{ 255.5f }, Neat::get_id<uint8_t>());
+	REQUIRE(largest.type_id() == Neat::get_id<uint8_t>());
+	CHECK(largest.value<uint8_t>() == 255);
+
+	CHECK(!Neat::convert(Neat::Any{ 256.0f }, Neat::get_id<uint8_t>()).has_value());
+	CHECK(!Neat::convert(Neat::Any{ -1.0 }, Neat::get_id<unsigned int>()).has_value());
+	CHECK(!Neat::convert(Neat::Any{ 1e30 }, Neat::get_id<int64_t>()).has_value());
+	CHECK(!Neat::convert(Neat::Any{ std::numeric_limits<double>::quiet_NaN() }, Neat::get_id<int>()).has_value());
+	CHECK(!Neat::convert(Neat::Any{ -std::numeric_limits<float>::infinity() }, Neat::get_id<short>()).has_value());
+
+	// Any non zero value, NaN included, is true
+	auto to_bool = Neat::convert(Neat::Any{ std::numeric_limits<double>::quiet_NaN() }, Neat::get_id<bool>());
+	REQUIRE(to_bool.type_id() == Neat::get_id<bool>());
+	CHECK(to_bool.value<bool>() == true);
+}
+
+TEST_CASE("Convert to and from strings")
+{
+	using namespace std::string_literals;
+
+	auto from_int = Neat::convert(Neat::Any{ 42 }, Neat::get_id<std::string>());
+	REQUIRE(from_int.type_id() == Neat::get_id<std::string>());
+	CHECK(from_int.value<std::string>() == "42");
+
+	auto from_bool = Neat::convert(Neat::Any{ true }, Neat::get_id<std::string>());
+	REQUIRE(from_bool.type_id() == Neat::get_id<std::string>());
+	CHECK(from_bool.value<std::string>() == "true");
+
+	auto to_int = Neat::convert(Neat::Any{ "-12"s }, Neat::get_id<int>());
+	REQUIRE(to_int.type_id() == Neat::get_id<int>());
+	CHECK(to_int.value<int>() == -12);
+
+	auto to_double = Neat::convert(Neat::Any{ "2.5"s }, Neat::get_id<double>());
+	REQUIRE(to_double.type_id() == Neat::get_id<double>());
+	CHECK(to_double.value<double>() == Catch::Approx(2.5));
+
+	auto invalid = Neat::convert(Neat::Any{ "not a number"s }, Neat::get_id<int>());
+	CHECK(!invalid.has_value());
+
+	auto trailing_garbage = Neat::convert(Neat::Any{ "12abc"s }, Neat::get_id<int>());
+	CHECK(!trailing_garbage.has_value());
+}
+
+TEST_CASE("Convert without a registered conversion")
+{
+	CHECK(Neat::get_conversion(Neat::get_id<ConversionTestCelsius>(), Neat::get_id<int>()) == nullptr);
+	CHECK(!Neat::convert(Neat::Any{ ConversionTestCelsius{ 1.0 } }, Neat::get_id<int>()).has_value());
+	CHECK(!Neat::convert(Neat::Any{}, Neat::get_id<int>()).has_value());
+}
+
+TEST_CASE("Convert with user registered conversions")
+{
+	Neat::register_conversion(Neat::get_id<ConversionTestCelsius>(), Neat::get_id<ConversionTestFahrenheit>(), &celsius_to_fahrenheit);
+
+	ConversionTestCelsius celsius{ 100.0 };
+	auto fahrenheit = Neat::convert(Neat::AnyConstRef{ celsius }, Neat::get_id<ConversionTestFahrenheit>());
+	REQUIRE(fahrenheit.type_id() == Neat::get_id<ConversionTestFahrenheit>());
+	CHECK(fahrenheit.value<ConversionTestFahrenheit>().degrees == Catch::Approx(212.0));
+
+	Neat::register_conversion<ConversionTestCelsius, ConversionTestCelsius>();
+	CHECK(Neat::get_conversion(Neat::get_id<ConversionTestCelsius>(), Neat::get_id<ConversionTestCelsius>()) != nullptr);
+}
@@ -0,0 +1,225 @@
+#include "catch2/catch_all.hpp"
+#include "neat/DeepCompare.h"
+#include "neat/Reflection.h"
+#include "ObjectTestTypes.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+struct DeepCompareTestObject : ObjectTestBase
+{
+	int x = 0;
+	int y = 0; // Merged with `x` into one memcmp
+	char flag = 0; // Padding follows
+	double factor = 1.0;
+	std::string name;
+	std::vector<ObjectTestPacked> items;
+	std::map<std::string, int> counters;
+	std::unique_ptr<ObjectTestPacked> optional_item;
+};
+
+class DeepCompareTestPrivatelyDerived : ObjectTestBase
+{
+public:
+	explicit DeepCompareTestPrivatelyDerived(int base) { base_value = base; }
+
+	double factor = 1.0;
+
+	bool operator==(const DeepCompareTestPrivatelyDerived& other) const { return base_value == other.base_value && factor == other.factor; }
+	size_t hash() const { return std::hash<int>{}(base_value) ^ std::hash<double>{}(factor); }
+};
+
+template<>
+struct std::hash<DeepCompareTestPrivatelyDerived>
+{
+	size_t operator()(const DeepCompareTestPrivatelyDerived& object) const { return object.hash(); }
+};
+
+static void register_deep_compare_test_types()
+{
+	register_object_test_types();
+	Neat::add_type(Neat::Type::create<DeepCompareTestObject>("DeepCompareTestObject", Neat::get_id<DeepCompareTestObject>(),
+		{ Neat::BaseClass::create<DeepCompareTestObject, ObjectTestBase>(Neat::Access::Public) }, {
+			Neat::Field::create<DeepCompareTestObject, int, &DeepCompareTestObject::x>("x", Neat::Access::Public),
+			Neat::Field::create<DeepCompareTestObject, int, &DeepCompareTestObject::y>("y", Neat::Access::Public),
+			Neat::Field::create<DeepCompareTestObject, char, &DeepCompareTestObject::flag>("flag", Neat::Access::Public),
+			Neat::Field::create<DeepCompareTestObject, double, &DeepCompareTestObject::factor>("factor", Neat::Access::Public),
+			Neat::Field::create<DeepCompareTestObject, std::string, &DeepCompareTestObject::name>("name", Neat::Access::Public),
+			Neat::Field::create<DeepCompareTestObject, std::vector<ObjectTestPacked>, &DeepCompareTestObject::items>("items", Neat::Access::Public),
+			Neat::Field::create<DeepCompareTestObject, std::map<std::string, int>, &DeepCompareTestObject::counters>("counters", Neat::Access::Public),
+			Neat::Field::create<DeepCompareTestObject, std::unique_ptr<ObjectTestPacked>, &DeepCompareTestObject::optional_item>("optional_item", Neat::Access::Public),
+		}, {}, {}, {}));
+}
+
+static void fill_deep_compare_test_object(DeepCompareTestObject& object)
+{
+	object.base_value = 7;
+	object.x = 1;
+	object.y = 2;
+	object.flag = 'f';
+	object.factor = 0.5;
+	object.name = "A name which doesn't fit in the small string buffer";
+	object.items = { { 1, 2 }, { 3, 4 } };
+	object.counters = { { "kills", 3 }, { "deaths", 1 } };
+	object.optional_item = std::make_unique<ObjectTestPacked>();
+}
+
+static Neat::AnyPtr deep_compare_ptr(DeepCompareTestObject& object)
+{
+	return Neat::AnyPtr{ &object, Neat::get_id<DeepCompareTestObject>() };
+}
+
+TEST_CASE("deep_equal compares fields, bases, containers and pointees")
+{
+	register_deep_compare_test_types();
+
+	DeepCompareTestObject a{};
+	DeepCompareTestObject b{};
+	fill_deep_compare_test_object(a);
+	fill_deep_compare_test_object(b);
+
+	CHECK(Neat::deep_equal(deep_compare_ptr(a), deep_compare_ptr(b)));
+	CHECK(Neat::deep_hash(deep_compare_ptr(a)) == Neat::deep_hash(deep_compare_ptr(b)));
+
+	b.base_value = 8;
+	CHECK(!Neat::deep_equal(deep_compare_ptr(a), deep_compare_ptr(b)));
+	b.base_value = 7;
+
+	b.y = 3;
+	CHECK(!Neat::deep_equal(deep_compare_ptr(a), deep_compare_ptr(b)));
+	b.y = 2;
+
+	b.factor = 0.25;
+	CHECK(!Neat::deep_equal(deep_compare_ptr(a), deep_compare_ptr(b)));
+	b.factor = 0.5;
+
+	b.name += "!";
+	CHECK(!Neat::deep_equal(deep_compare_ptr(a), deep_compare_ptr(b)));
+	b.name.pop_back();
+
+	b.items[1].b = 5;
+	CHECK(!Neat::deep_equal(deep_compare_ptr(a), deep_compare_ptr(b)));
+	b.items[1].b = 4;
+
+	b.counters["kills"] = 4;
+	CHECK(!Neat::deep_equal(deep_compare_ptr(a), deep_compare_ptr(b)));
+	b.counters["kills"] = 3;
+
+	b.optional_item->a = 9;
+	CHECK(!Neat::deep_equal(deep_compare_ptr(a), deep_compare_ptr(b)));
+	b.optional_item.reset();
+	CHECK(!Neat::deep_equal(deep_compare_ptr(a), deep_compare_ptr(b)));
+	a.optional_item.reset();
+
+	CHECK(Neat::deep_equal(deep_compare_ptr(a), deep_compare_ptr(b)));
+	CHECK(Neat::deep_hash(deep_compare_ptr(a)) == Neat::deep_hash(deep_compare_ptr(b)));
+}
+
+TEST_CASE("deep_equal ignores padding and distinguishes types")
+{
+	register_deep_compare_test_types();
+
+	DeepCompareTestObject a{};
+	DeepCompareTestObject b{};
+	fill_deep_compare_test_object(a);
+	fill_deep_compare_test_object(b);
+
+	// Scribble over the padding after `flag`
+	auto* padding_a = reinterpret_cast<unsigned char*>(&a.flag) + 1;
+	auto* padding_b = reinterpret_cast<unsigned char*>(&b.flag) + 1;
+	*padding_a = 0xAA;
+	*padding_b = 0x55;
+	CHECK(Neat::deep_equal(deep_compare_ptr(a), deep_compare_ptr(b)));
+	CHECK(Neat::deep_hash(deep_compare_ptr(a)) == Neat::deep_hash(deep_compare_ptr(b)));
+
+	ObjectTestPacked packed{};
+	CHECK(!Neat::deep_equal(deep_compare_ptr(a), Neat::AnyPtr{ &packed, Neat::get_id<ObjectTestPacked>() }));
+	CHECK(Neat::deep_equal(deep_compare_ptr(a), deep_compare_ptr(a)));
+}
+
+TEST_CASE("deep_hash of maps doesn't depend on insertion order")
+{
+	register_deep_compare_test_types();
+
+	std::map<std::string, int> a{ { "one", 1 }, { "two", 2 } };
+	std::map<std::string, int> b{};
+	b["two"] = 2;
+	b["one"] = 1;
+
+	const auto id = Neat::get_id<std::map<std::string, int>>();
+	CHECK(Neat::deep_equal(Neat::AnyPtr{ &a, id }, Neat::AnyPtr{ &b, id }));
+	CHECK(Neat::deep_hash(Neat::AnyPtr{ &a, id }) == Neat::deep_hash(Neat::AnyPtr{ &b, id }));
+}
+
+struct DeepCompareTestNode
+{
+	int value = 0;
+	std::shared_ptr<DeepCompareTestNode> next;
+	DeepCompareTestNode* parent = nullptr;
+};
+
+TEST_CASE("deep_equal and deep_hash stop at cycles")
+{
+	register_object_test_types();
+	Neat::add_type(Neat::Type::create<std::shared_ptr<DeepCompareTestNode>>("std::shared_ptr<DeepCompareTestNode>", Neat::get_id<std::shared_ptr<DeepCompareTestNode>>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<DeepCompareTestNode*>("DeepCompareTestNode*", Neat::get_id<DeepCompareTestNode*>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<DeepCompareTestNode>("DeepCompareTestNode", Neat::get_id<DeepCompareTestNode>(), {}, {
+			Neat::Field::create<DeepCompareTestNode, int, &DeepCompareTestNode::value>("value", Neat::Access::Public),
+			Neat::Field::create<DeepCompareTestNode, std::shared_ptr<DeepCompareTestNode>, &DeepCompareTestNode::next>("next", Neat::Access::Public),
+			Neat::Field::create<DeepCompareTestNode, DeepCompareTestNode*, &DeepCompareTestNode::parent>("parent", Neat::Access::Public),
+		}, {}, {}, {}));
+
+	// Two rings of two nodes each
+	const auto make_ring = [](int first_value, int second_value) {
+		auto first = std::make_shared<DeepCompareTestNode>();
+		auto second = std::make_shared<DeepCompareTestNode>();
+		first->value = first_value;
+		second->value = second_value;
+		first->next = second;
+		second->next = first;
+		return first;
+	};
+	auto a = make_ring(1, 2);
+	auto b = make_ring(1, 2);
+	auto c = make_ring(1, 3);
+
+	const auto id = Neat::get_id<DeepCompareTestNode>();
+	CHECK(Neat::deep_equal(Neat::AnyPtr{ a.get(), id }, Neat::AnyPtr{ b.get(), id }));
+	CHECK(!Neat::deep_equal(Neat::AnyPtr{ a.get(), id }, Neat::AnyPtr{ c.get(), id }));
+	CHECK(Neat::deep_hash(Neat::AnyPtr{ a.get(), id }) == Neat::deep_hash(Neat::AnyPtr{ b.get(), id }));
+
+	// Raw pointers compare by address, they aren't followed
+	a->next->parent = a.get();
+	b->next->parent = b.get();
+	CHECK(!Neat::deep_equal(Neat::AnyPtr{ a.get(), id }, Neat::AnyPtr{ b.get(), id }));
+	b->next->parent = a.get();
+	CHECK(Neat::deep_equal(Neat::AnyPtr{ a.get(), id }, Neat::AnyPtr{ b.get(), id }));
+
+	// Break the rings so they're freed
+	a->next->next.reset();
+	b->next->next.reset();
+	c->next->next.reset();
+}
+
+TEST_CASE("deep_equal uses operator== when a base can't be reached")
+{
+	register_deep_compare_test_types();
+	Neat::add_type(Neat::Type::create<DeepCompareTestPrivatelyDerived>("DeepCompareTestPrivatelyDerived", Neat::get_id<DeepCompareTestPrivatelyDerived>(),
+		{ Neat::BaseClass{ Neat::get_id<ObjectTestBase>(), Neat::Access::Private } }, {
+			Neat::Field::create<DeepCompareTestPrivatelyDerived, double, &DeepCompareTestPrivatelyDerived::factor>("factor", Neat::Access::Public),
+		}, {}, {}, {}));
+
+	// Only the private base differs
+	DeepCompareTestPrivatelyDerived a{ 1 };
+	DeepCompareTestPrivatelyDerived b{ 2 };
+	DeepCompareTestPrivatelyDerived c{ 1 };
+	const auto id = Neat::get_id<DeepCompareTestPrivatelyDerived>();
+
+	CHECK(!Neat::deep_equal({ &a, id }, { &b, id }));
+	CHECK(Neat::deep_equal({ &a, id }, { &c, id }));
+	CHECK(Neat::deep_hash({ &a, id }) == Neat::deep_hash({ &c, id }));
+	CHECK(Neat::deep_hash({ &a, id }) != Neat::deep_hash({ &b, id }));
+}
@@ -0,0 +1,327 @@
+#include "catch2/catch_all.hpp"
+#include "neat/Diff.h"
+#include "neat/DeepCompare.h"
+#include "neat/Enum.h"
+#include "neat/Reflection.h"
+#include "ObjectTestTypes.h"
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+struct DiffTestItem
+{
+	std::string label;
+	int count = 0;
+};
+
+struct DiffTestObject : ObjectTestBase
+{
+	int x = 0;
+	int y = 0;
+	int z = 0; // `x`, `y` and `z` form one run
+	char flag = 0; // Padding follows
+	double factor = 1.0;
+	std::string name;
+	std::vector<ObjectTestPacked> packed_items;
+	std::vector<DiffTestItem> items;
+	std::unique_ptr<ObjectTestPacked> owned;
+	std::map<std::string, int> counters;
+};
+
+static void register_diff_test_types()
+{
+	register_object_test_types();
+	Neat::add_type(Neat::Type::create<DiffTestItem>("DiffTestItem", Neat::get_id<DiffTestItem>(), {}, {
+			Neat::Field::create<DiffTestItem, std::string, &DiffTestItem::label>("label", Neat::Access::Public),
+			Neat::Field::create<DiffTestItem, int, &DiffTestItem::count>("count", Neat::Access::Public),
+		}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<std::vector<DiffTestItem>>("std::vector<DiffTestItem>", Neat::get_id<std::vector<DiffTestItem>>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<DiffTestObject>("DiffTestObject", Neat::get_id<DiffTestObject>(),
+		{ Neat::BaseClass::create<DiffTestObject, ObjectTestBase>(Neat::Access::Public) }, {
+			Neat::Field::create<DiffTestObject, int, &DiffTestObject::x>("x", Neat::Access::Public),
+			Neat::Field::create<DiffTestObject, int, &DiffTestObject::y>("y", Neat::Access::Public),
+			Neat::Field::create<DiffTestObject, int, &DiffTestObject::z>("z", Neat::Access::Public),
+			Neat::Field::create<DiffTestObject, char, &DiffTestObject::flag>("flag", Neat::Access::Public),
+			Neat::Field::create<DiffTestObject, double, &DiffTestObject::factor>("factor", Neat::Access::Public),
+			Neat::Field::create<DiffTestObject, std::string, &DiffTestObject::name>("name", Neat::Access::Public),
+			Neat::Field::create<DiffTestObject, std::vector<ObjectTestPacked>, &DiffTestObject::packed_items>("packed_items", Neat::Access::Public),
+			Neat::Field::create<DiffTestObject, std::vector<DiffTestItem>, &DiffTestObject::items>("items", Neat::Access::Public),
+			Neat::Field::create<DiffTestObject, std::unique_ptr<ObjectTestPacked>, &DiffTestObject::owned>("owned", Neat::Access::Public),
+			Neat::Field::create<DiffTestObject, std::map<std::string, int>, &DiffTestObject::counters>("counters", Neat::Access::Public),
+		}, {}, {}, {}));
+}
+
+static void fill_diff_test_object(DiffTestObject& object)
+{
+	object.base_value = 7;
+	object.x = 1;
+	object.y = 2;
+	object.z = 3;
+	object.flag = 'f';
+	object.factor = 0.5;
+	object.name = "A name which doesn't fit in the small string buffer";
+	object.packed_items = { { 1, 2 }, { 3, 4 } };
+	object.items = { { "first", 1 }, { "second", 2 } };
+	object.owned = std::make_unique<ObjectTestPacked>();
+	object.counters = { { "kills", 3 } };
+}
+
+static Neat::AnyPtr diff_test_ptr(DiffTestObject& object)
+{
+	return Neat::AnyPtr{ &object, Neat::get_id<DiffTestObject>() };
+}
+
+TEST_CASE("diff of equal objects is empty")
+{
+	register_diff_test_types();
+
+	DiffTestObject old_object{};
+	DiffTestObject new_object{};
+	fill_diff_test_object(old_object);
+	fill_diff_test_object(new_object);
+
+	// Padding isn't part of the value
+	*(reinterpret_cast<unsigned char*>(&new_object.flag) + 1) = 0xAA;
+
+	Neat::Patch patch{};
+	CHECK(Neat::diff(diff_test_ptr(old_object), diff_test_ptr(new_object), patch));
+	CHECK(patch.empty());
+	CHECK(Neat::apply_patch(diff_test_ptr(old_object), patch.bytes()));
+}
+
+TEST_CASE("diff only sends the changed span of a run")
+{
+	register_diff_test_types();
+
+	DiffTestObject old_object{};
+	DiffTestObject new_object{};
+	fill_diff_test_object(old_object);
+	fill_diff_test_object(new_object);
+	new_object.y = 20;
+
+	Neat::Patch patch{};
+	REQUIRE(Neat::diff(diff_test_ptr(old_object), diff_test_ptr(new_object), patch));
+
+	// op, depth, one path element, size, the bytes of `y`
+	CHECK(patch.data.size() == 1 + 1 + sizeof(uint32_t) + sizeof(uint32_t) + sizeof(int));
+
+	REQUIRE(Neat::apply_patch(diff_test_ptr(old_object), patch.bytes()));
+	CHECK(old_object.y == 20);
+	CHECK(Neat::deep_equal(diff_test_ptr(old_object), diff_test_ptr(new_object)));
+}
+
+TEST_CASE("apply_patch turns the old object into the new one")
+{
+	register_diff_test_types();
+
+	DiffTestObject old_object{};
+	DiffTestObject new_object{};
+	fill_diff_test_object(old_object);
+	fill_diff_test_object(new_object);
+
+	new_object.base_value = 8;
+	new_object.x = 10;
+	new_object.z = 30;
+	new_object.factor = 0.25;
+	new_object.name = "short";
+	new_object.packed_items.push_back({ 5, 6 });
+	new_object.items[1].count = 5;
+	new_object.items.push_back({ "third", 3 });
+
+	SECTION("Pointee changed")
+	{
+		new_object.owned->b = 9;
+	}
+	SECTION("Pointer reset")
+	{
+		new_object.owned.reset();
+	}
+	SECTION("Pointee emplaced")
+	{
+		old_object.owned.reset();
+		new_object.owned->a = 4;
+	}
+
+	Neat::Patch patch{};
+	REQUIRE(Neat::diff(diff_test_ptr(old_object), diff_test_ptr(new_object), patch));
+	REQUIRE(Neat::apply_patch(diff_test_ptr(old_object), patch.bytes()));
+	CHECK(Neat::deep_equal(diff_test_ptr(old_object), diff_test_ptr(new_object)));
+
+	// Removing elements
+	DiffTestObject cleared_object{};
+	cleared_object.counters = new_object.counters;
+	Neat::Patch shrink{};
+	REQUIRE(Neat::diff(diff_test_ptr(new_object), diff_test_ptr(cleared_object), shrink));
+	REQUIRE(Neat::apply_patch(diff_test_ptr(old_object), shrink.bytes()));
+	CHECK(Neat::deep_equal(diff_test_ptr(old_object), diff_test_ptr(cleared_object)));
+}
+
+TEST_CASE("diff reports changes it can't represent")
+{
+	register_diff_test_types();
+
+	DiffTestObject old_object{};
+	DiffTestObject new_object{};
+	fill_diff_test_object(old_object);
+	fill_diff_test_object(new_object);
+	new_object.x = 5;
+	new_object.counters["deaths"] = 1;
+
+	Neat::Patch patch{};
+	CHECK(!Neat::diff(diff_test_ptr(old_object), diff_test_ptr(new_object), patch));
+	CHECK(!patch.empty()); // The representable changes are still recorded
+}
+
+TEST_CASE("apply_patch rejects malformed patches")
+{
+	register_diff_test_types();
+
+	DiffTestObject old_object{};
+	DiffTestObject new_object{};
+	fill_diff_test_object(old_object);
+	fill_diff_test_object(new_object);
+	new_object.name = "changed";
+
+	Neat::Patch patch{};
+	REQUIRE(Neat::diff(diff_test_ptr(old_object), diff_test_ptr(new_object), patch));
+
+	SECTION("Truncated")
+	{
+		patch.data.pop_back();
+		CHECK(!Neat::apply_patch(diff_test_ptr(old_object), patch.bytes()));
+	}
+	SECTION("Unknown member")
+	{
+		const uint32_t bad_ordinal = 1000;
+		std::memcpy(patch.data.data() + 2, &bad_ordinal, sizeof(bad_ordinal));
+		CHECK(!Neat::apply_patch(diff_test_ptr(old_object), patch.bytes()));
+	}
+	SECTION("Assigning more than the run")
+	{
+		ObjectTestPacked packed{};
+		std::vector<std::byte> oversized_assign(1 + 1 + sizeof(uint32_t) + sizeof(uint32_t) + 3 * sizeof(int));
+		const uint8_t depth = 1;
+		const uint32_t ordinal = 1; // `b`
+		const uint32_t size = 3 * sizeof(int);
+		std::memcpy(oversized_assign.data() + 1, &depth, sizeof(depth));
+		std::memcpy(oversized_assign.data() + 2, &ordinal, sizeof(ordinal));
+		std::memcpy(oversized_assign.data() + 6, &size, sizeof(size));
+		CHECK(!Neat::apply_patch(Neat::AnyPtr{ &packed, Neat::get_id<ObjectTestPacked>() }, oversized_assign));
+	}
+	SECTION("Resizing past the limit")
+	{
+		std::vector<std::byte> huge_resize(1 + 1 + sizeof(uint32_t) + sizeof(uint32_t));
+		const Neat::Patch::Op op = Neat::Patch::Op::Resize;
+		const uint8_t depth = 1;
+		const uint32_t ordinal = 8; // `items`, after the base and seven fields
+		const uint32_t size = UINT32_MAX;
+		std::memcpy(huge_resize.data(), &op, sizeof(op));
+		std::memcpy(huge_resize.data() + 1, &depth, sizeof(depth));
+		std::memcpy(huge_resize.data() + 2, &ordinal, sizeof(ordinal));
+		std::memcpy(huge_resize.data() + 6, &size, sizeof(size));
+		CHECK(!Neat::apply_patch(diff_test_ptr(old_object), huge_resize));
+		CHECK(old_object.items.size() == 2);
+
+		// Within the limit it's applied
+		const uint32_t small_size = 5;
+		std::memcpy(huge_resize.data() + 6, &small_size, sizeof(small_size));
+		CHECK(Neat::apply_patch(diff_test_ptr(old_object), huge_resize));
+		CHECK(old_object.items.size() == 5);
+	}
+}
+
+enum class DiffTestState : uint8_t { Idle, Running, Stopped };
+
+struct DiffTestFlags
+{
+	int id = 0;
+	bool active = false;
+	DiffTestState state = DiffTestState::Idle;
+	ObjectTestPacked* target = nullptr;
+};
+
+static void register_diff_test_flags()
+{
+	register_diff_test_types();
+	Neat::add_type(Neat::Type::create<DiffTestState>("DiffTestState", Neat::get_id<DiffTestState>(), {}, {}, {}, {}, {}));
+	Neat::add_enum(Neat::Enum::create<DiffTestState>("DiffTestState", {
+			{ "Idle", DiffTestState::Idle }, { "Running", DiffTestState::Running }, { "Stopped", DiffTestState::Stopped } }));
+	Neat::add_type(Neat::Type::create<DiffTestFlags>("DiffTestFlags", Neat::get_id<DiffTestFlags>(), {}, {
+			Neat::Field::create<DiffTestFlags, int, &DiffTestFlags::id>("id", Neat::Access::Public),
+			Neat::Field::create<DiffTestFlags, bool, &DiffTestFlags::active>("active", Neat::Access::Public),
+			Neat::Field::create<DiffTestFlags, DiffTestState, &DiffTestFlags::state>("state", Neat::Access::Public),
+			Neat::Field::create<DiffTestFlags, ObjectTestPacked*, &DiffTestFlags::target>("target", Neat::Access::Public),
+		}, {}, {}, {}));
+}
+
+TEST_CASE("diff validates bools and enums and doesn't send raw pointers")
+{
+	register_diff_test_flags();
+
+	DiffTestFlags old_object{};
+	DiffTestFlags new_object{};
+	new_object.id = 3;
+	new_object.active = true;
+	new_object.state = DiffTestState::Stopped;
+
+	Neat::Patch patch{};
+	REQUIRE(Neat::diff(Neat::AnyPtr{ &old_object, Neat::get_id<DiffTestFlags>() }, Neat::AnyPtr{ &new_object, Neat::get_id<DiffTestFlags>() }, patch));
+	DiffTestFlags patched{};
+	REQUIRE(Neat::apply_patch(Neat::AnyPtr{ &patched, Neat::get_id<DiffTestFlags>() }, patch.bytes()));
+	CHECK(patched.id == 3);
+	CHECK(patched.active);
+	CHECK(patched.state == DiffTestState::Stopped);
+
+	// Assign: op, depth 1, the member ordinal, a one byte payload
+	const auto assign_byte = [](uint32_t ordinal, uint8_t value) {
+		std::vector<std::byte> change(1 + 1 + sizeof(uint32_t) + sizeof(uint32_t) + 1);
+		const uint8_t depth = 1;
+		const uint32_t size = 1;
+		std::memcpy(change.data() + 1, &depth, sizeof(depth));
+		std::memcpy(change.data() + 2, &ordinal, sizeof(ordinal));
+		std::memcpy(change.data() + 6, &size, sizeof(size));
+		std::memcpy(change.data() + 10, &value, sizeof(value));
+		return change;
+	};
+	CHECK(Neat::apply_patch(Neat::AnyPtr{ &patched, Neat::get_id<DiffTestFlags>() }, assign_byte(1, 0)));
+	CHECK(!patched.active);
+	CHECK(!Neat::apply_patch(Neat::AnyPtr{ &patched, Neat::get_id<DiffTestFlags>() }, assign_byte(1, 2)));
+	CHECK(Neat::apply_patch(Neat::AnyPtr{ &patched, Neat::get_id<DiffTestFlags>() }, assign_byte(2, 1)));
+	CHECK(patched.state == DiffTestState::Running);
+	CHECK(!Neat::apply_patch(Neat::AnyPtr{ &patched, Neat::get_id<DiffTestFlags>() }, assign_byte(2, 7)));
+	CHECK(patched.state == DiffTestState::Running);
+
+	// Raw pointers can't be represented
+	ObjectTestPacked packed{};
+	new_object.target = &packed;
+	CHECK(!Neat::diff(Neat::AnyPtr{ &old_object, Neat::get_id<DiffTestFlags>() }, Neat::AnyPtr{ &new_object, Neat::get_id<DiffTestFlags>() }, patch));
+	CHECK(Neat::apply_patch(Neat::AnyPtr{ &patched, Neat::get_id<DiffTestFlags>() }, patch.bytes()));
+	CHECK(patched.target == nullptr);
+}
+
+struct DiffTestHiddenBase : ObjectTestBase
+{
+	int value = 0;
+};
+
+TEST_CASE("diff reports bases it can't reach")
+{
+	register_diff_test_types();
+	Neat::add_type(Neat::Type::create<DiffTestHiddenBase>("DiffTestHiddenBase", Neat::get_id<DiffTestHiddenBase>(),
+		{ Neat::BaseClass{ Neat::get_id<ObjectTestBase>(), Neat::Access::Private, nullptr } }, {
+			Neat::Field::create<DiffTestHiddenBase, int, &DiffTestHiddenBase::value>("value", Neat::Access::Public),
+		}, {}, {}, {}));
+
+	DiffTestHiddenBase old_object{};
+	DiffTestHiddenBase new_object{};
+	new_object.value = 2;
+
+	Neat::Patch patch{};
+	CHECK(!Neat::diff(Neat::AnyPtr{ &old_object, Neat::get_id<DiffTestHiddenBase>() }, Neat::AnyPtr{ &new_object, Neat::get_id<DiffTestHiddenBase>() }, patch));
+	CHECK(!patch.empty());
+}
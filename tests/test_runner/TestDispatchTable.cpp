@@ -0,0 +1,76 @@
+#include "catch2/catch_all.hpp"
+#include "neat/DispatchTable.h"
+#include "neat/Reflection.h"
+
+#include <string>
+
+
+struct DispatchTestShape { virtual ~DispatchTestShape() = default; int sides = 0; };
+struct DispatchTestPadding { double padding = 0.0; };
+struct DispatchTestSquare : DispatchTestPadding, DispatchTestShape { DispatchTestSquare() { sides = 4; } };
+struct DispatchTestColoredSquare : DispatchTestSquare { int color = 0; };
+struct DispatchTestUnhandled {};
+
+TEST_CASE("DispatchTable calls the handler of the object's type")
+{
+	auto table = Neat::DispatchTable<std::string(int)>::create(
+		[](const int& value, int offset) { return std::to_string(value + offset); },
+		[](const std::string& value, int) { return value; },
+		[](double& value, int offset) { value += offset; return std::string{ "double" }; }
+	);
+
+	int i = 5;
+	std::string s = "text";
+	double d = 1.0;
+
+	CHECK(Neat::visit(Neat::AnyPtr{ &i, Neat::get_id<int>() }, table, 10) == "15");
+	CHECK(Neat::visit(Neat::AnyPtr{ &s, Neat::get_id<std::string>() }, table, 0) == "text");
+	CHECK(table(Neat::AnyPtr{ &d, Neat::get_id<double>() }, 2) == "double");
+	CHECK(d == 3.0); // Handlers can modify the object
+
+	CHECK(table.contains(Neat::get_id<int>()));
+	CHECK(!table.contains(Neat::get_id<float>()));
+}
+
+TEST_CASE("DispatchTable default handler and explicit handler types")
+{
+	Neat::DispatchTable<int()> table{};
+	table.add<float>([](const auto&) { return 1; });
+	table.set_default([](Neat::AnyPtr object) { return object.value_ptr == nullptr ? -1 : 0; });
+
+	float f = 0.0f;
+	DispatchTestUnhandled unhandled{};
+	CHECK(Neat::visit(Neat::AnyPtr{ &f, Neat::get_id<float>() }, table) == 1);
+	CHECK(Neat::visit(Neat::AnyPtr{ &unhandled, Neat::get_id<DispatchTestUnhandled>() }, table) == 0);
+
+	// Overwriting a handler
+	table.add([](float&) { return 2; });
+	CHECK(Neat::visit(Neat::AnyPtr{ &f, Neat::get_id<float>() }, table) == 2);
+
+	// Copies share their handlers
+	const auto copy = table;
+	CHECK(Neat::visit(Neat::AnyPtr{ &f, Neat::get_id<float>() }, copy) == 2);
+}
+
+TEST_CASE("DispatchTable falls back to base classes")
+{
+	Neat::add_type(Neat::Type::create<DispatchTestShape>("DispatchTestShape", Neat::get_id<DispatchTestShape>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<DispatchTestPadding>("DispatchTestPadding", Neat::get_id<DispatchTestPadding>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<DispatchTestSquare>("DispatchTestSquare", Neat::get_id<DispatchTestSquare>(),
+		{ Neat::BaseClass::create<DispatchTestSquare, DispatchTestPadding>(Neat::Access::Public), Neat::BaseClass::create<DispatchTestSquare, DispatchTestShape>(Neat::Access::Public) },
+		{}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<DispatchTestColoredSquare>("DispatchTestColoredSquare", Neat::get_id<DispatchTestColoredSquare>(),
+		{ Neat::BaseClass::create<DispatchTestColoredSquare, DispatchTestSquare>(Neat::Access::Public) }, {}, {}, {}, {}));
+
+	auto table = Neat::DispatchTable<int()>::create([](const DispatchTestShape& shape) { return shape.sides; });
+	CHECK(!table.contains(Neat::get_id<DispatchTestColoredSquare>()));
+
+	table.add_base_class_fallback();
+	CHECK(table.contains(Neat::get_id<DispatchTestSquare>()));
+	CHECK(table.contains(Neat::get_id<DispatchTestColoredSquare>()));
+	CHECK(!table.contains(Neat::get_id<DispatchTestPadding>()));
+
+	// The shape isn't the first base, so the pointer needs adjusting
+	DispatchTestColoredSquare square{};
+	CHECK(Neat::visit(Neat::AnyPtr{ &square, Neat::get_id<DispatchTestColoredSquare>() }, table) == 4);
+}
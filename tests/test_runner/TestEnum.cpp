@@ -0,0 +1,80 @@
+#include "catch2/catch_all.hpp"
+#include "neat/Enum.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+enum class EnumTestColour : uint8_t { Red, Green, Blue, Crimson = Red };
+enum class EnumTestSparse : int64_t { Low = -1000000, Zero = 0, High = 1000000000000 };
+struct EnumTestLargeTag {};
+enum EnumTestPermissions : uint32_t { None = 0, Read = 1 << 0, Write = 1 << 1, Execute = 1 << 2, ReadWrite = Read | Write };
+
+TEST_CASE("Dense enum lookups")
+{
+	const Neat::Enum& colour = Neat::add_enum(Neat::Enum::create<EnumTestColour>("EnumTestColour", {
+		{ "Red", EnumTestColour::Red }, { "Green", EnumTestColour::Green }, { "Blue", EnumTestColour::Blue }, { "Crimson", EnumTestColour::Crimson } }));
+
+	CHECK(colour.underlying_type() == Neat::get_id<uint8_t>());
+	CHECK(colour.size() == 1);
+	CHECK(colour.enumerators().size() == 4);
+
+	CHECK(colour.to_name(EnumTestColour::Green) == "Green");
+	CHECK(colour.to_name(EnumTestColour::Red) == "Red"); // First enumerator with the value
+	CHECK(colour.to_name(int64_t{ 42 }).empty());
+
+	CHECK(colour.to_value<EnumTestColour>("Blue") == EnumTestColour::Blue);
+	CHECK(colour.to_value<EnumTestColour>("Crimson") == EnumTestColour::Red);
+	CHECK(!colour.to_value("Purple").has_value());
+
+	CHECK(Neat::get_enum<EnumTestColour>() == &colour);
+	CHECK(Neat::get_enum("EnumTestColour") == &colour);
+}
+
+TEST_CASE("Sparse enum lookups")
+{
+	const Neat::Enum& sparse = Neat::add_enum(Neat::Enum::create<EnumTestSparse>("EnumTestSparse", {
+		{ "Low", EnumTestSparse::Low }, { "Zero", EnumTestSparse::Zero }, { "High", EnumTestSparse::High } }));
+
+	CHECK(sparse.to_name(EnumTestSparse::Low) == "Low");
+	CHECK(sparse.to_name(EnumTestSparse::High) == "High");
+	CHECK(sparse.to_name(int64_t{ 1 }).empty());
+	CHECK(sparse.to_value<EnumTestSparse>("High") == EnumTestSparse::High);
+}
+
+TEST_CASE("Name lookups in a large enum")
+{
+	std::vector<Neat::Enumerator> enumerators;
+	for (int i = 0; i < 1000; ++i) {
+		enumerators.push_back({ "Value" + std::to_string(i), i * 3 });
+	}
+	Neat::Enum large{ "EnumTestLarge", Neat::get_id<EnumTestLargeTag>(), Neat::get_id<int>(), sizeof(int), true, enumerators };
+
+	for (int i = 0; i < 1000; ++i) {
+		REQUIRE(large.to_value("Value" + std::to_string(i)) == i * 3);
+		REQUIRE(large.to_name(int64_t{ i * 3 }) == "Value" + std::to_string(i));
+	}
+	CHECK(!large.to_value("Value1000").has_value());
+}
+
+TEST_CASE("Flag enum decomposition")
+{
+	const Neat::Enum& permissions = Neat::add_enum(Neat::Enum::create<EnumTestPermissions>("EnumTestPermissions", {
+		{ "None", None }, { "Read", Read }, { "Write", Write }, { "Execute", Execute }, { "ReadWrite", ReadWrite } }));
+
+	int64_t remaining = -1;
+	auto names = permissions.decompose(Read | Write | Execute | (1 << 8), &remaining);
+	REQUIRE(names.size() == 2);
+	CHECK(names[0] == "ReadWrite");
+	CHECK(names[1] == "Execute");
+	CHECK(remaining == (1 << 8));
+
+	CHECK(permissions.compose("Read | Execute") == (Read | Execute));
+	CHECK(!permissions.compose("Read|Delete").has_value());
+
+	EnumTestPermissions value = Write;
+	CHECK(permissions.get_value(Neat::AnyConstRef{ value }) == Write);
+	permissions.set_value(Neat::AnyRef{ value }, Read | Execute);
+	CHECK(value == (Read | Execute));
+}
@@ -0,0 +1,144 @@
+#include "catch2/catch_all.hpp"
+#include "neat/FieldGather.h"
+#include "neat/Reflection.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+struct FieldGatherTestEntity
+{
+	float position[3] = {};
+	int32_t health = 100;
+	uint8_t team = 0;
+	double speed = 1.0;
+	std::string name = "Entity";
+};
+
+struct FieldGatherTestPolymorphicEntity
+{
+	virtual ~FieldGatherTestPolymorphicEntity() = default;
+	int64_t score = 0;
+};
+
+TEST_CASE("Gather and scatter trivially copyable fields")
+{
+	auto health = Neat::Field::create<FieldGatherTestEntity, int32_t, &FieldGatherTestEntity::health>("health", Neat::Access::Public);
+	auto team = Neat::Field::create<FieldGatherTestEntity, uint8_t, &FieldGatherTestEntity::team>("team", Neat::Access::Public);
+	auto speed = Neat::Field::create<FieldGatherTestEntity, double, &FieldGatherTestEntity::speed>("speed", Neat::Access::Public);
+
+	// Not a multiple of the SIMD width, so the scalar tail is exercised too
+	std::vector<FieldGatherTestEntity> entities(37);
+	for (size_t i = 0; i < entities.size(); ++i) {
+		entities[i].health = int32_t(i) * 10;
+		entities[i].team = uint8_t(i % 3);
+		entities[i].speed = double(i) * 0.5;
+	}
+	Neat::AnyPtr objects{ entities.data(), Neat::get_id<FieldGatherTestEntity>() };
+
+	std::vector<int32_t> healths(entities.size());
+	Neat::gather(health, objects, sizeof(FieldGatherTestEntity), entities.size(), healths.data());
+	CHECK(healths[0] == 0);
+	CHECK(healths[17] == 170);
+	CHECK(healths[36] == 360);
+
+	std::vector<uint8_t> teams(entities.size());
+	Neat::gather(team, objects, sizeof(FieldGatherTestEntity), entities.size(), teams.data());
+	CHECK(teams[4] == 1);
+	CHECK(teams[35] == 2);
+
+	std::vector<double> speeds(entities.size());
+	Neat::gather(speed, objects, sizeof(FieldGatherTestEntity), entities.size(), speeds.data());
+	CHECK(speeds[9] == 4.5);
+	CHECK(speeds[36] == 18.0);
+
+	for (auto& value : healths) {
+		value += 1;
+	}
+	Neat::scatter(health, objects, sizeof(FieldGatherTestEntity), entities.size(), healths.data());
+	CHECK(entities[0].health == 1);
+	CHECK(entities[36].health == 361);
+	CHECK(entities[36].speed == 18.0);
+}
+
+TEST_CASE("Gather and scatter fields which aren't trivially copyable")
+{
+	Neat::add_type(Neat::Type::create<std::string>("std::string", Neat::get_id<std::string>(), {}, {}, {}, {}, {}));
+	auto name = Neat::Field::create<FieldGatherTestEntity, std::string, &FieldGatherTestEntity::name>("name", Neat::Access::Public);
+
+	std::vector<FieldGatherTestEntity> entities(3);
+	entities[1].name = "A name which doesn't fit in the small string buffer";
+	Neat::AnyPtr objects{ entities.data(), Neat::get_id<FieldGatherTestEntity>() };
+
+	alignas(std::string) std::byte storage[3 * sizeof(std::string)];
+	Neat::gather(name, objects, sizeof(FieldGatherTestEntity), entities.size(), storage);
+	auto* names = std::launder(reinterpret_cast<std::string*>(storage));
+	CHECK(names[0] == "Entity");
+	CHECK(names[1] == "A name which doesn't fit in the small string buffer");
+
+	names[2] = "Renamed";
+	Neat::scatter(name, objects, sizeof(FieldGatherTestEntity), entities.size(), names);
+	CHECK(entities[2].name == "Renamed");
+	CHECK(entities[1].name == "A name which doesn't fit in the small string buffer");
+
+	for (int i = 0; i < 3; ++i) {
+		names[i].~basic_string();
+	}
+}
+
+// Assignment keeps the slot, only a copy constructed handle gets a new one
+struct FieldGatherTestHandle
+{
+	FieldGatherTestHandle() = default;
+	FieldGatherTestHandle(const FieldGatherTestHandle& other) : value(other.value) {}
+	FieldGatherTestHandle& operator=(const FieldGatherTestHandle& other) { value = other.value; return *this; }
+
+	int slot = -1;
+	std::string value;
+};
+
+struct FieldGatherTestOwner
+{
+	FieldGatherTestHandle handle;
+};
+
+TEST_CASE("Scatter copy assigns fields")
+{
+	Neat::add_type(Neat::Type::create<FieldGatherTestHandle>("FieldGatherTestHandle", Neat::get_id<FieldGatherTestHandle>(), {}, {}, {}, {}, {}));
+	auto handle = Neat::Field::create<FieldGatherTestOwner, FieldGatherTestHandle, &FieldGatherTestOwner::handle>("handle", Neat::Access::Public);
+
+	std::vector<FieldGatherTestOwner> owners(2);
+	owners[0].handle.slot = 4;
+	owners[1].handle.slot = 5;
+
+	std::vector<FieldGatherTestHandle> values(2);
+	values[0].value = "A value which doesn't fit in the small string buffer";
+	values[1].value = "Second";
+	Neat::scatter(handle, Neat::AnyPtr{ owners.data(), Neat::get_id<FieldGatherTestOwner>() }, sizeof(FieldGatherTestOwner), owners.size(), values.data());
+
+	CHECK(owners[0].handle.value == "A value which doesn't fit in the small string buffer");
+	CHECK(owners[0].handle.slot == 4);
+	CHECK(owners[1].handle.value == "Second");
+	CHECK(owners[1].handle.slot == 5);
+}
+
+TEST_CASE("Gather fields without a fixed offset")
+{
+	auto score = Neat::Field::create<FieldGatherTestPolymorphicEntity, int64_t, &FieldGatherTestPolymorphicEntity::score>("score", Neat::Access::Public);
+	REQUIRE(!score.offset.has_value());
+
+	std::vector<FieldGatherTestPolymorphicEntity> entities(5);
+	for (size_t i = 0; i < entities.size(); ++i) {
+		entities[i].score = int64_t(i) * 1000;
+	}
+	Neat::AnyPtr objects{ entities.data(), Neat::get_id<FieldGatherTestPolymorphicEntity>() };
+
+	std::vector<int64_t> scores(entities.size());
+	Neat::gather(score, objects, sizeof(FieldGatherTestPolymorphicEntity), entities.size(), scores.data());
+	CHECK(scores[4] == 4000);
+
+	scores[2] = -1;
+	Neat::scatter(score, objects, sizeof(FieldGatherTestPolymorphicEntity), entities.size(), scores.data());
+	CHECK(entities[2].score == -1);
+}
@@ -0,0 +1,68 @@
+#include "catch2/catch_all.hpp"
+#include "neat/FieldHandle.h"
+#include "neat/Reflection.h"
+
+#include <string>
+#include <vector>
+
+
+struct FieldHandleTestType
+{
+	int health;
+	std::string name;
+};
+
+struct FieldHandleTestPolymorphicType
+{
+	virtual ~FieldHandleTestPolymorphicType() = default;
+	double speed;
+};
+
+TEST_CASE("FieldHandle type check")
+{
+	auto field = Neat::Field::create<FieldHandleTestType, int, &FieldHandleTestType::health>("health", Neat::Access::Public);
+
+	auto handle = Neat::FieldHandle<int>::create(field);
+	CHECK(handle.is_valid());
+	CHECK(handle.object_type() == Neat::get_id<FieldHandleTestType>());
+
+	auto wrong_handle = Neat::FieldHandle<double>::create(field);
+	CHECK(!wrong_handle);
+
+	Neat::FieldHandle<int> default_handle{};
+	CHECK(!default_handle);
+}
+
+TEST_CASE("FieldHandle with fixed offset")
+{
+	auto field = Neat::Field::create<FieldHandleTestType, std::string, &FieldHandleTestType::name>("name", Neat::Access::Public);
+	auto handle = Neat::FieldHandle<std::string>::create(field);
+	REQUIRE(handle);
+
+	std::vector<FieldHandleTestType> objects{ { 1, "One" }, { 2, "Two" } };
+
+	CHECK(handle.get(Neat::AnyRef{ objects[1] }) == "Two");
+	CHECK(&handle.ref(Neat::AnyRef{ objects[0] }) == &objects[0].name);
+
+	handle.set(Neat::AnyRef{ objects[0] }, "Changed");
+	CHECK(objects[0].name == "Changed");
+
+	const FieldHandleTestType& const_object = objects[1];
+	CHECK(&handle.get(Neat::AnyConstRef{ const_object }) == &objects[1].name);
+}
+
+TEST_CASE("FieldHandle without fixed offset")
+{
+	auto field = Neat::Field::create<FieldHandleTestPolymorphicType, double, &FieldHandleTestPolymorphicType::speed>("speed", Neat::Access::Public);
+	REQUIRE(!field.offset.has_value());
+
+	auto handle = Neat::FieldHandle<double>::create(field);
+	REQUIRE(handle);
+
+	FieldHandleTestPolymorphicType object{};
+	object.speed = 4.0;
+
+	CHECK(handle.get(Neat::AnyRef{ object }) == Catch::Approx(4.0));
+	handle.ref(Neat::AnyRef{ object }) = 8.0;
+	CHECK(object.speed == Catch::Approx(8.0));
+}
@@ -0,0 +1,117 @@
+#include "catch2/catch_all.hpp"
+#include "neat/FieldPath.h"
+#include "neat/Reflection.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+struct FieldPathTestInner
+{
+	float factor = 1.5f;
+	std::string label = "Inner";
+};
+
+struct FieldPathTestPolymorphic
+{
+	virtual ~FieldPathTestPolymorphic() = default;
+	FieldPathTestInner inner{};
+};
+
+struct FieldPathTestOuter
+{
+	int id = 0;
+	FieldPathTestInner sub_object{};
+	FieldPathTestPolymorphic polymorphic{};
+};
+
+static void register_field_path_test_types()
+{
+	Neat::add_type(Neat::Type::create<std::string>("std::string", Neat::get_id<std::string>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<FieldPathTestInner>("FieldPathTestInner", Neat::get_id<FieldPathTestInner>(), {}, {
+			Neat::Field::create<FieldPathTestInner, float, &FieldPathTestInner::factor>("factor", Neat::Access::Public),
+			Neat::Field::create<FieldPathTestInner, std::string, &FieldPathTestInner::label>("label", Neat::Access::Public),
+		}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<FieldPathTestPolymorphic>("FieldPathTestPolymorphic", Neat::get_id<FieldPathTestPolymorphic>(), {}, {
+			Neat::Field::create<FieldPathTestPolymorphic, FieldPathTestInner, &FieldPathTestPolymorphic::inner>("inner", Neat::Access::Public),
+		}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<FieldPathTestOuter>("FieldPathTestOuter", Neat::get_id<FieldPathTestOuter>(), {}, {
+			Neat::Field::create<FieldPathTestOuter, int, &FieldPathTestOuter::id>("id", Neat::Access::Public),
+			Neat::Field::create<FieldPathTestOuter, FieldPathTestInner, &FieldPathTestOuter::sub_object>("sub_object", Neat::Access::Public),
+			Neat::Field::create<FieldPathTestOuter, FieldPathTestPolymorphic, &FieldPathTestOuter::polymorphic>("polymorphic", Neat::Access::Public),
+		}, {}, {}, {}));
+}
+
+TEST_CASE("Compile field paths")
+{
+	register_field_path_test_types();
+
+	auto factor = Neat::FieldPath::compile(Neat::get_id<FieldPathTestOuter>(), "sub_object.factor");
+	REQUIRE(factor.is_valid());
+	CHECK(factor.object_type() == Neat::get_id<FieldPathTestOuter>());
+	CHECK(factor.type() == Neat::get_id<float>());
+	REQUIRE(factor.offset().has_value());
+	FieldPathTestOuter object{};
+	CHECK(reinterpret_cast<std::byte*>(&object) + *factor.offset() == reinterpret_cast<std::byte*>(&object.sub_object.factor));
+
+	auto through_polymorphic = Neat::FieldPath::compile(Neat::get_id<FieldPathTestOuter>(), "polymorphic.inner.factor");
+	REQUIRE(through_polymorphic.is_valid());
+	CHECK(!through_polymorphic.offset().has_value());
+
+	CHECK(!Neat::FieldPath::compile(Neat::get_id<FieldPathTestOuter>(), "sub_object.missing").is_valid());
+	CHECK(!Neat::FieldPath::compile(Neat::get_id<FieldPathTestOuter>(), "id.factor").is_valid());
+	CHECK(!Neat::FieldPath::compile(Neat::get_id<FieldPathTestOuter>(), "").is_valid());
+}
+
+TEST_CASE("Get and set through field paths")
+{
+	register_field_path_test_types();
+
+	FieldPathTestOuter object{};
+	auto factor = Neat::FieldPath::compile(Neat::get_id<FieldPathTestOuter>(), "sub_object.factor");
+	CHECK(factor.get<float>(object) == 1.5f);
+	factor.set<float>(object, 2.0f);
+	CHECK(object.sub_object.factor == 2.0f);
+
+	auto label = Neat::FieldPath::compile(Neat::get_id<FieldPathTestOuter>(), "polymorphic.inner.label");
+	Neat::AnyPtr object_ptr{ &object, Neat::get_id<FieldPathTestOuter>() };
+	CHECK(label.get_value(object_ptr).value<std::string>() == "Inner");
+	label.set_value(object_ptr, std::string{ "Changed" });
+	CHECK(object.polymorphic.inner.label == "Changed");
+	CHECK(label.resolve(Neat::AnyRef{ object }).value_ptr == &object.polymorphic.inner.label);
+}
+
+TEST_CASE("Batch access through field paths")
+{
+	register_field_path_test_types();
+
+	std::vector<FieldPathTestOuter> objects(20);
+	for (size_t i = 0; i < objects.size(); ++i) {
+		objects[i].sub_object.factor = float(i);
+		objects[i].polymorphic.inner.factor = float(i) * 2.0f;
+	}
+	Neat::AnyPtr objects_ptr{ objects.data(), Neat::get_id<FieldPathTestOuter>() };
+
+	auto factor = Neat::FieldPath::compile(Neat::get_id<FieldPathTestOuter>(), "sub_object.factor");
+	std::vector<float> factors(objects.size());
+	factor.gather(objects_ptr, sizeof(FieldPathTestOuter), objects.size(), factors.data());
+	CHECK(factors[19] == 19.0f);
+
+	auto polymorphic_factor = Neat::FieldPath::compile(Neat::get_id<FieldPathTestOuter>(), "polymorphic.inner.factor");
+	polymorphic_factor.gather(objects_ptr, sizeof(FieldPathTestOuter), objects.size(), factors.data());
+	CHECK(factors[19] == 38.0f);
+
+	polymorphic_factor.scatter(objects_ptr, sizeof(FieldPathTestOuter), objects.size(), factors.data());
+	factor.scatter(objects_ptr, sizeof(FieldPathTestOuter), objects.size(), factors.data());
+	CHECK(objects[10].sub_object.factor == 20.0f);
+	CHECK(objects[10].polymorphic.inner.factor == 20.0f);
+
+	// Not trivially copyable, copy assigned
+	auto label = Neat::FieldPath::compile(Neat::get_id<FieldPathTestOuter>(), "polymorphic.inner.label");
+	std::vector<std::string> labels(objects.size(), "A label which doesn't fit in the small string buffer");
+	labels[3] = "Third";
+	label.scatter(objects_ptr, sizeof(FieldPathTestOuter), objects.size(), labels.data());
+	CHECK(objects[3].polymorphic.inner.label == "Third");
+	CHECK(objects[19].polymorphic.inner.label == "A label which doesn't fit in the small string buffer");
+}
@@ -0,0 +1,143 @@
+#include "catch2/catch_all.hpp"
+#include "neat/Reflection.h"
+
+#include <array>
+#include <cstddef>
+#include <new>
+#include <string>
+
+
+namespace function_test
+{
+	static int call_count = 0;
+	static const int max_players = 16;
+	static std::string server_name = "Server";
+
+	static std::string greet(const std::string& name, int times)
+	{
+		++call_count;
+		std::string greeting;
+		for (int i = 0; i < times; ++i) {
+			greeting += "Hello " + name + "! ";
+		}
+		return greeting;
+	}
+
+	static std::string shout(std::string text)
+	{
+		text += "!";
+		return text;
+	}
+
+	static int scale(int value) { return value * 2; }
+	static double scale(double value) { return value * 0.5; }
+
+	struct Spawner
+	{
+		static void reset(int& counter) { counter = 0; }
+	};
+}
+
+static void register_function_test_entries()
+{
+	Neat::add_function(Neat::Function::create<&function_test::greet, std::string, const std::string&, int>("function_test::greet"));
+	Neat::add_function(Neat::Function::create<&function_test::Spawner::reset, void, int&>("function_test::Spawner::reset"));
+	Neat::add_function(Neat::Function::create<&function_test::shout, std::string, std::string>("function_test::shout"));
+	Neat::add_function(Neat::Function::create<static_cast<int (*)(int)>(&function_test::scale), int, int>("function_test::scale"));
+	Neat::add_function(Neat::Function::create<static_cast<double (*)(double)>(&function_test::scale), double, double>("function_test::scale"));
+	Neat::add_variable(Neat::Variable::create<int, &function_test::call_count>("function_test::call_count"));
+	Neat::add_variable(Neat::Variable::create<const int, &function_test::max_players>("function_test::max_players"));
+	Neat::add_variable(Neat::Variable::create<std::string, &function_test::server_name>("function_test::server_name"));
+}
+
+TEST_CASE("Look up functions by qualified name")
+{
+	register_function_test_entries();
+
+	const Neat::Function* greet = Neat::get_function("function_test::greet");
+	REQUIRE(greet != nullptr);
+	CHECK(greet->argument_passing == std::vector<Neat::Passing>{ Neat::Passing::ConstLValueReference, Neat::Passing::Value });
+	CHECK(Neat::get_function("function_test::missing") == nullptr);
+
+	// Adding the same functions twice doesn't duplicate them
+	const size_t function_count = Neat::get_functions().size();
+	register_function_test_entries();
+	CHECK(Neat::get_functions().size() == function_count);
+}
+
+TEST_CASE("Overloads are kept")
+{
+	register_function_test_entries();
+
+	const std::vector<const Neat::Function*> overloads = Neat::get_functions("function_test::scale");
+	REQUIRE(overloads.size() == 2);
+	CHECK(overloads[0]->argument_types == std::vector<Neat::TemplateTypeId>{ Neat::get_id<int>() });
+	CHECK(overloads[1]->argument_types == std::vector<Neat::TemplateTypeId>{ Neat::get_id<double>() });
+	CHECK(Neat::get_function("function_test::scale") == overloads[0]);
+	CHECK(Neat::get_functions("function_test::missing").empty());
+
+	double value = 3.0;
+	double result = 0.0;
+	std::array<Neat::AnyPtr, 1> arguments{ Neat::AnyPtr{ &value, Neat::get_id<double>() } };
+	overloads[1]->invoke_in_place(arguments, Neat::AnyPtr{ &result, Neat::get_id<double>() });
+	CHECK(result == 1.5);
+}
+
+TEST_CASE("Invoke free and static member functions")
+{
+	register_function_test_entries();
+	const Neat::Function* greet = Neat::get_function("function_test::greet");
+	REQUIRE(greet != nullptr);
+
+	std::string name = "World";
+	int times = 2;
+	std::array<Neat::AnyPtr, 2> arguments{ Neat::AnyPtr{ &name, Neat::get_id<std::string>() }, Neat::AnyPtr{ &times, Neat::get_id<int>() } };
+	alignas(std::string) std::byte storage[sizeof(std::string)];
+	greet->invoke_in_place(arguments, Neat::AnyPtr{ storage, Neat::get_id<std::string>() });
+
+	auto* result = std::launder(reinterpret_cast<std::string*>(storage));
+	CHECK(*result == "Hello World! Hello World! ");
+	result->~basic_string();
+
+	std::array<Neat::Any, 2> any_arguments{ Neat::Any{ std::string{ "Neat" } }, Neat::Any{ 1 } };
+	CHECK(greet->invoke(any_arguments).value<std::string>() == "Hello Neat! ");
+
+	const Neat::Function* reset = Neat::get_function("function_test::Spawner::reset");
+	REQUIRE(reset != nullptr);
+	int counter = 5;
+	std::array<Neat::AnyPtr, 1> reset_arguments{ Neat::AnyPtr{ &counter, Neat::get_id<int>() } };
+	reset->invoke_in_place(reset_arguments, Neat::AnyPtr{});
+	CHECK(counter == 0);
+
+	// By value parameters get a copy, the caller's value is left alone
+	const Neat::Function* shout = Neat::get_function("function_test::shout");
+	REQUIRE(shout != nullptr);
+	std::string text = "A text which doesn't fit in the small string buffer";
+	std::array<Neat::AnyPtr, 1> shout_arguments{ Neat::AnyPtr{ &text, Neat::get_id<std::string>() } };
+	shout->invoke_in_place(shout_arguments, Neat::AnyPtr{ storage, Neat::get_id<std::string>() });
+	result = std::launder(reinterpret_cast<std::string*>(storage));
+	CHECK(*result == "A text which doesn't fit in the small string buffer!");
+	CHECK(text == "A text which doesn't fit in the small string buffer");
+	result->~basic_string();
+}
+
+TEST_CASE("Read and write variables")
+{
+	register_function_test_entries();
+
+	const Neat::Variable* max_players = Neat::get_variable("function_test::max_players");
+	REQUIRE(max_players != nullptr);
+	CHECK(max_players->is_const);
+	CHECK(max_players->set_value == nullptr);
+	CHECK(max_players->type == Neat::get_id<int>());
+	CHECK(max_players->get_value().value<int>() == 16);
+
+	const Neat::Variable* server_name = Neat::get_variable("function_test::server_name");
+	REQUIRE(server_name != nullptr);
+	server_name->set_value(std::string{ "Renamed" });
+	CHECK(function_test::server_name == "Renamed");
+	CHECK(server_name->get_const_ref().get<std::string>() == "Renamed");
+
+	server_name->get_ref().get<std::string>() = "Changed";
+	CHECK(function_test::server_name == "Changed");
+}
@@ -0,0 +1,119 @@
+#include "catch2/catch_all.hpp"
+#include "neat/Reflection.h"
+#include "neat/AnyVector.h"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+struct InvokeBatchTestType
+{
+	int value = 0;
+
+	std::string name;
+
+	void add(int amount) { value += amount; }
+	void rename(std::string new_name) { name = std::move(new_name); }
+	void take_name(std::string&& new_name) { name = std::move(new_name); }
+	int scaled(int factor) const { return value * factor; }
+	void take_owned(std::unique_ptr<int> owned) { value = *owned; }
+	void take_owned_ref(std::unique_ptr<int>&& owned) { value = *owned; }
+	void read_owned(const std::unique_ptr<int>& owned) { value = *owned; }
+};
+
+TEST_CASE("Invoke batch without return values")
+{
+	auto add = Neat::Method::create<&InvokeBatchTestType::add, InvokeBatchTestType, void, int>("add", Neat::Access::Public);
+
+	std::vector<InvokeBatchTestType> objects(100);
+	std::vector<Neat::AnyPtr> object_ptrs;
+	for (auto& object : objects) {
+		object_ptrs.push_back(Neat::AnyPtr{ &object, Neat::get_id<InvokeBatchTestType>() });
+	}
+
+	int amount = 5;
+	std::array<Neat::AnyPtr, 1> arguments{ Neat::AnyPtr{ &amount, Neat::get_id<int>() } };
+	add.invoke_batch(object_ptrs, arguments, Neat::AnyPtr{});
+	add.invoke_batch(object_ptrs, arguments, Neat::AnyPtr{});
+
+	CHECK(objects.front().value == 10);
+	CHECK(objects.back().value == 10);
+}
+
+TEST_CASE("Invoke batch into an AnyVector")
+{
+	Neat::add_type(Neat::Type::create<int>("int", Neat::get_id<int>(), {}, {}, {}, {}, {}));
+	auto scaled = Neat::Method::create<&InvokeBatchTestType::scaled, InvokeBatchTestType, int, int>("scaled", Neat::Access::Public);
+
+	std::vector<InvokeBatchTestType> objects(10);
+	std::vector<Neat::AnyPtr> object_ptrs;
+	for (int i = 0; i < 10; ++i) {
+		objects[i].value = i;
+		object_ptrs.push_back(Neat::AnyPtr{ &objects[i], Neat::get_id<InvokeBatchTestType>() });
+	}
+
+	int factor = 3;
+	std::array<Neat::AnyPtr, 1> arguments{ Neat::AnyPtr{ &factor, Neat::get_id<int>() } };
+
+	Neat::AnyVector results{ Neat::get_id<int>() };
+	results.resize(objects.size());
+	scaled.invoke_batch(object_ptrs, arguments, Neat::AnyPtr{ results.data(), results.type_id() });
+
+	auto values = results.as_span<int>();
+	CHECK(values[0] == 0);
+	CHECK(values[4] == 12);
+	CHECK(values[9] == 27);
+}
+
+TEST_CASE("Invoke batch copies non-trivial arguments for every call")
+{
+	auto rename = Neat::Method::create<&InvokeBatchTestType::rename, InvokeBatchTestType, void, std::string>("rename", Neat::Access::Public);
+	auto take_name = Neat::Method::create<&InvokeBatchTestType::take_name, InvokeBatchTestType, void, std::string&&>("take_name", Neat::Access::Public);
+
+	std::vector<InvokeBatchTestType> objects(3);
+	std::vector<Neat::AnyPtr> object_ptrs;
+	for (auto& object : objects) {
+		object_ptrs.push_back(Neat::AnyPtr{ &object, Neat::get_id<InvokeBatchTestType>() });
+	}
+
+	std::string name = "A name which doesn't fit in the small string buffer";
+	std::array<Neat::AnyPtr, 1> arguments{ Neat::AnyPtr{ &name, Neat::get_id<std::string>() } };
+
+	rename.invoke_batch(object_ptrs, arguments, Neat::AnyPtr{});
+	for (const auto& object : objects) {
+		CHECK(object.name == "A name which doesn't fit in the small string buffer");
+	}
+	CHECK(name == "A name which doesn't fit in the small string buffer");
+
+	for (auto& object : objects) {
+		object.name.clear();
+	}
+	take_name.invoke_batch(object_ptrs, arguments, Neat::AnyPtr{});
+	CHECK(objects.back().name == "A name which doesn't fit in the small string buffer");
+	CHECK(name == "A name which doesn't fit in the small string buffer");
+}
+
+TEST_CASE("Invoke batch needs copyable arguments")
+{
+	auto take_owned = Neat::Method::create<&InvokeBatchTestType::take_owned, InvokeBatchTestType, void, std::unique_ptr<int>>("take_owned", Neat::Access::Public);
+	auto take_owned_ref = Neat::Method::create<&InvokeBatchTestType::take_owned_ref, InvokeBatchTestType, void, std::unique_ptr<int>&&>("take_owned_ref", Neat::Access::Public);
+	auto read_owned = Neat::Method::create<&InvokeBatchTestType::read_owned, InvokeBatchTestType, void, const std::unique_ptr<int>&>("read_owned", Neat::Access::Public);
+	CHECK(take_owned.invoke_batch == nullptr);
+	CHECK(take_owned.invoke_in_place == nullptr);
+	CHECK(take_owned_ref.invoke_batch == nullptr);
+	CHECK(take_owned_ref.invoke_in_place != nullptr);
+	REQUIRE(read_owned.invoke_batch != nullptr);
+
+	std::vector<InvokeBatchTestType> objects(3);
+	std::vector<Neat::AnyPtr> object_ptrs;
+	for (auto& object : objects) {
+		object_ptrs.push_back(Neat::AnyPtr{ &object, Neat::get_id<InvokeBatchTestType>() });
+	}
+
+	auto owned = std::make_unique<int>(4);
+	std::array<Neat::AnyPtr, 1> arguments{ Neat::AnyPtr{ &owned, Neat::get_id<std::unique_ptr<int>>() } };
+	read_owned.invoke_batch(object_ptrs, arguments, Neat::AnyPtr{});
+	CHECK(objects.back().value == 4);
+}
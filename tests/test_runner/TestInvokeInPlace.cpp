@@ -0,0 +1,120 @@
+#include "catch2/catch_all.hpp"
+#include "neat/Reflection.h"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+
+
+struct InvokeInPlaceTestResult
+{
+	std::string text;
+	int length;
+};
+
+struct InvokeInPlaceTestType
+{
+	int counter = 0;
+
+	InvokeInPlaceTestResult describe(const std::string& prefix, int value) const
+	{
+		return { prefix + std::to_string(value), value };
+	}
+
+	void increment(int& value)
+	{
+		++value;
+		++counter;
+	}
+
+	std::string append(std::string text) const
+	{
+		text += "!";
+		return text;
+	}
+
+	std::string take(std::string&& text) const
+	{
+		return std::move(text);
+	}
+};
+
+static int invoke_in_place_test_take_owned(std::unique_ptr<int> value) { return *value; }
+static int invoke_in_place_test_take_owned_ref(std::unique_ptr<int>&& value) { return *value; }
+
+TEST_CASE("Invoke in place with a return slot")
+{
+	auto method = Neat::Method::create<&InvokeInPlaceTestType::describe, InvokeInPlaceTestType, InvokeInPlaceTestResult, const std::string&, int>("describe", Neat::Access::Public);
+
+	InvokeInPlaceTestType object{};
+	std::string prefix = "A prefix which doesn't fit in the small string buffer: ";
+	int value = 42;
+	std::array<Neat::AnyPtr, 2> arguments{ Neat::AnyPtr{ &prefix, Neat::get_id<std::string>() }, Neat::AnyPtr{ &value, Neat::get_id<int>() } };
+
+	alignas(InvokeInPlaceTestResult) std::byte storage[sizeof(InvokeInPlaceTestResult)];
+	method.invoke_in_place(Neat::AnyPtr{ &object, Neat::get_id<InvokeInPlaceTestType>() }, arguments, Neat::AnyPtr{ storage, Neat::get_id<InvokeInPlaceTestResult>() });
+
+	auto* result = std::launder(reinterpret_cast<InvokeInPlaceTestResult*>(storage));
+	CHECK(result->text == "A prefix which doesn't fit in the small string buffer: 42");
+	CHECK(result->length == 42);
+	result->~InvokeInPlaceTestResult();
+
+	// An empty return slot discards the result
+	method.invoke_in_place(Neat::AnyPtr{ &object, Neat::get_id<InvokeInPlaceTestType>() }, arguments, Neat::AnyPtr{});
+}
+
+TEST_CASE("Invoke in place binds reference arguments")
+{
+	auto method = Neat::Method::create<&InvokeInPlaceTestType::increment, InvokeInPlaceTestType, void, int&>("increment", Neat::Access::Public);
+
+	InvokeInPlaceTestType object{};
+	int value = 1;
+	std::array<Neat::AnyPtr, 1> arguments{ Neat::AnyPtr{ &value, Neat::get_id<int>() } };
+
+	method.invoke_in_place(Neat::AnyPtr{ &object, Neat::get_id<InvokeInPlaceTestType>() }, arguments, Neat::AnyPtr{});
+	CHECK(value == 2);
+	CHECK(object.counter == 1);
+}
+
+TEST_CASE("Invoke in place copies by value arguments")
+{
+	auto append = Neat::Method::create<&InvokeInPlaceTestType::append, InvokeInPlaceTestType, std::string, std::string>("append", Neat::Access::Public);
+	auto take = Neat::Method::create<&InvokeInPlaceTestType::take, InvokeInPlaceTestType, std::string, std::string&&>("take", Neat::Access::Public);
+
+	InvokeInPlaceTestType object{};
+	std::string text = "A text which doesn't fit in the small string buffer";
+	std::array<Neat::AnyPtr, 1> arguments{ Neat::AnyPtr{ &text, Neat::get_id<std::string>() } };
+
+	alignas(std::string) std::byte storage[sizeof(std::string)];
+	append.invoke_in_place(Neat::AnyPtr{ &object, Neat::get_id<InvokeInPlaceTestType>() }, arguments, Neat::AnyPtr{ storage, Neat::get_id<std::string>() });
+	auto* result = std::launder(reinterpret_cast<std::string*>(storage));
+	CHECK(*result == "A text which doesn't fit in the small string buffer!");
+	CHECK(text == "A text which doesn't fit in the small string buffer");
+	std::destroy_at(result);
+
+	// Only rvalue reference parameters move from the caller's value
+	take.invoke_in_place(Neat::AnyPtr{ &object, Neat::get_id<InvokeInPlaceTestType>() }, arguments, Neat::AnyPtr{ storage, Neat::get_id<std::string>() });
+	result = std::launder(reinterpret_cast<std::string*>(storage));
+	CHECK(*result == "A text which doesn't fit in the small string buffer");
+	CHECK(text.empty());
+	std::destroy_at(result);
+}
+
+TEST_CASE("Invoke in place needs copyable by value arguments")
+{
+	auto take_owned = Neat::Function::create<&invoke_in_place_test_take_owned, int, std::unique_ptr<int>>("invoke_in_place_test_take_owned");
+	CHECK(take_owned.invoke != nullptr);
+	CHECK(take_owned.invoke_in_place == nullptr);
+
+	// Rvalue reference parameters move from the caller's value instead
+	auto take_owned_ref = Neat::Function::create<&invoke_in_place_test_take_owned_ref, int, std::unique_ptr<int>&&>("invoke_in_place_test_take_owned_ref");
+	REQUIRE(take_owned_ref.invoke_in_place != nullptr);
+
+	auto value = std::make_unique<int>(3);
+	int result = 0;
+	std::array<Neat::AnyPtr, 1> arguments{ Neat::AnyPtr{ &value, Neat::get_id<std::unique_ptr<int>>() } };
+	take_owned_ref.invoke_in_place(arguments, { &result, Neat::get_id<int>() });
+	CHECK(result == 3);
+}
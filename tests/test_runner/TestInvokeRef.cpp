@@ -0,0 +1,69 @@
+#include "catch2/catch_all.hpp"
+#include "neat/Reflection.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+
+struct InvokeRefTestType
+{
+	std::vector<std::string> names{ "First", "Second" };
+
+	const std::vector<std::string>& get_names() const { return names; }
+	std::string& name_at(int index) { return names[index]; }
+	size_t count() const { return names.size(); }
+	void take(std::string&& name) { names.push_back(std::move(name)); }
+};
+
+TEST_CASE("Passing kinds are recorded")
+{
+	auto get_names = Neat::Method::create<&InvokeRefTestType::get_names, InvokeRefTestType, const std::vector<std::string>&>("get_names", Neat::Access::Public);
+	CHECK(get_names.return_passing == Neat::Passing::ConstLValueReference);
+	CHECK(get_names.argument_passing.empty());
+	CHECK(get_names.return_type == Neat::get_id<std::vector<std::string>>());
+
+	auto name_at = Neat::Method::create<&InvokeRefTestType::name_at, InvokeRefTestType, std::string&, int>("name_at", Neat::Access::Public);
+	CHECK(name_at.return_passing == Neat::Passing::LValueReference);
+	CHECK(name_at.argument_passing == std::vector<Neat::Passing>{ Neat::Passing::Value });
+
+	auto take = Neat::Method::create<&InvokeRefTestType::take, InvokeRefTestType, void, std::string&&>("take", Neat::Access::Public);
+	CHECK(take.argument_passing == std::vector<Neat::Passing>{ Neat::Passing::RValueReference });
+	CHECK(take.argument_types == std::vector<Neat::TemplateTypeId>{ Neat::get_id<std::string>() });
+
+	auto count = Neat::Method::create<&InvokeRefTestType::count, InvokeRefTestType, size_t>("count", Neat::Access::Public);
+	CHECK(count.return_passing == Neat::Passing::Value);
+	CHECK(count.invoke_ref == nullptr);
+}
+
+TEST_CASE("Invoke returning references")
+{
+	InvokeRefTestType object{};
+	Neat::AnyPtr object_ptr{ &object, Neat::get_id<InvokeRefTestType>() };
+
+	auto get_names = Neat::Method::create<&InvokeRefTestType::get_names, InvokeRefTestType, const std::vector<std::string>&>("get_names", Neat::Access::Public);
+	REQUIRE(get_names.invoke_ref != nullptr);
+	Neat::AnyConstRef names = get_names.invoke_ref(object_ptr, {});
+	CHECK(names.value_ptr == &object.names);
+	CHECK(names.type_id == Neat::get_id<std::vector<std::string>>());
+
+	auto name_at = Neat::Method::create<&InvokeRefTestType::name_at, InvokeRefTestType, std::string&, int>("name_at", Neat::Access::Public);
+	int index = 1;
+	std::array<Neat::AnyPtr, 1> arguments{ Neat::AnyPtr{ &index, Neat::get_id<int>() } };
+	Neat::AnyRef name = name_at.invoke_ref(object_ptr, arguments);
+	name.get<std::string>() = "Changed";
+	CHECK(object.names[1] == "Changed");
+}
+
+TEST_CASE("Invoke with rvalue reference arguments")
+{
+	InvokeRefTestType object{};
+	auto take = Neat::Method::create<&InvokeRefTestType::take, InvokeRefTestType, void, std::string&&>("take", Neat::Access::Public);
+
+	std::string name = "A name which doesn't fit in the small string buffer";
+	std::array<Neat::AnyPtr, 1> arguments{ Neat::AnyPtr{ &name, Neat::get_id<std::string>() } };
+	take.invoke_in_place(Neat::AnyPtr{ &object, Neat::get_id<InvokeRefTestType>() }, arguments, Neat::AnyPtr{});
+
+	REQUIRE(object.names.size() == 3);
+	CHECK(object.names[2] == "A name which doesn't fit in the small string buffer");
+}
@@ -0,0 +1,73 @@
+#include "catch2/catch_all.hpp"
+#include "neat/Reflection.h"
+
+#include <cstddef>
+#include <string>
+
+
+struct LayoutTestSubObject
+{
+	int id;
+	double factor;
+};
+
+struct LayoutTestBase
+{
+	int health;
+};
+
+struct LayoutTestType : LayoutTestBase
+{
+	std::string name;
+	alignas(32) LayoutTestSubObject sub_object;
+};
+
+struct LayoutTestPolymorphicType
+{
+	virtual ~LayoutTestPolymorphicType() = default;
+	int value;
+};
+
+TEST_CASE("Type alignment and layout flags")
+{
+	auto sub_object_type = Neat::Type::create<LayoutTestSubObject>("LayoutTestSubObject", Neat::get_id<LayoutTestSubObject>(), {}, {}, {}, {}, {});
+	CHECK(sub_object_type.size == sizeof(LayoutTestSubObject));
+	CHECK(sub_object_type.alignment == alignof(LayoutTestSubObject));
+	CHECK(sub_object_type.has_flags(Neat::TypeFlags::TriviallyCopyable | Neat::TypeFlags::StandardLayout));
+	CHECK(!sub_object_type.has_flags(Neat::TypeFlags::HasUniqueObjectRepresentations)); // Contains padding and a double
+
+	auto int_type = Neat::Type::create<int>("int", Neat::get_id<int>(), {}, {}, {}, {}, {});
+	CHECK(int_type.has_flags(Neat::TypeFlags::HasUniqueObjectRepresentations | Neat::TypeFlags::TriviallyDestructible));
+
+	auto type = Neat::Type::create<LayoutTestType>("LayoutTestType", Neat::get_id<LayoutTestType>(), {}, {}, {}, {}, {});
+	CHECK(type.alignment == 32);
+	CHECK(!type.has_flags(Neat::TypeFlags::TriviallyCopyable));
+	CHECK(!type.has_flags(Neat::TypeFlags::StandardLayout));
+}
+
+TEST_CASE("Field offsets")
+{
+	auto health = Neat::Field::create<LayoutTestBase, int, &LayoutTestBase::health>("health", Neat::Access::Public);
+	REQUIRE(health.offset.has_value());
+	CHECK(*health.offset == offsetof(LayoutTestBase, health));
+	CHECK(health.size == sizeof(int));
+	CHECK(Neat::has_flags(health.type_flags, Neat::TypeFlags::TriviallyCopyable));
+
+	auto sub_object = Neat::Field::create<LayoutTestType, LayoutTestSubObject, &LayoutTestType::sub_object>("sub_object", Neat::Access::Public);
+	REQUIRE(sub_object.offset.has_value());
+	CHECK(*sub_object.offset % 32 == 0);
+	CHECK(sub_object.size == sizeof(LayoutTestSubObject));
+	CHECK(Neat::has_flags(sub_object.type_flags, Neat::TypeFlags::TriviallyCopyable));
+
+	// The offset must point at the same member as get_address
+	LayoutTestType object{};
+	auto address = sub_object.get_address({ &object, Neat::get_id<LayoutTestType>() });
+	CHECK(address.value_ptr == reinterpret_cast<std::byte*>(&object) + *sub_object.offset);
+
+	auto name = Neat::Field::create<LayoutTestType, std::string, &LayoutTestType::name>("name", Neat::Access::Public);
+	REQUIRE(name.offset.has_value());
+	CHECK(!Neat::has_flags(name.type_flags, Neat::TypeFlags::TriviallyCopyable));
+
+	auto polymorphic_value = Neat::Field::create<LayoutTestPolymorphicType, int, &LayoutTestPolymorphicType::value>("value", Neat::Access::Public);
+	CHECK(!polymorphic_value.offset.has_value());
+}
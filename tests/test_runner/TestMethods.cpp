@@ -5,6 +5,9 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <algorithm>
+#include <cstddef>
+#include <new>
 
 import TestModule1;
 
@@ -73,3 +76,65 @@ TEST_CASE("Invoke const method return")
 	REQUIRE(result_int != nullptr);
 	REQUIRE(*result_int == MethodTester::test_method_const_return_value);
 }
+
+TEST_CASE("Construct with a generated constructor")
+{
+	const Neat::Type* type = Neat::get_type<NonTrivialClass>();
+	REQUIRE(type != nullptr);
+
+	const bool has_int_constructor = std::any_of(type->constructors.begin(), type->constructors.end(), [](const Neat::Constructor& constructor) {
+		return constructor.argument_types == std::vector<Neat::TemplateTypeId>{ Neat::get_id<int>() };
+	});
+	CHECK(has_int_constructor);
+
+	int value = 42;
+	alignas(NonTrivialClass) std::byte storage[sizeof(NonTrivialClass)];
+	std::array<Neat::AnyPtr, 1> arguments{ Neat::AnyPtr{ &value, Neat::get_id<int>() } };
+	REQUIRE(type->construct({ storage, type->id }, arguments));
+
+	auto* object = std::launder(reinterpret_cast<NonTrivialClass*>(storage));
+	CHECK(object->get() == 42);
+
+	// Copy constructor
+	alignas(NonTrivialClass) std::byte copy_storage[sizeof(NonTrivialClass)];
+	std::array<Neat::AnyPtr, 1> copy_arguments{ Neat::AnyPtr{ object, type->id } };
+	REQUIRE(type->construct({ copy_storage, type->id }, copy_arguments));
+
+	auto* copy = std::launder(reinterpret_cast<NonTrivialClass*>(copy_storage));
+	CHECK(copy->get() == 42);
+
+	type->destructor({ copy, type->id });
+	type->destructor({ object, type->id });
+}
+
+TEST_CASE("Generated functions and variables")
+{
+	const std::vector<const Neat::Function*> multiply = Neat::get_functions("multiply");
+	REQUIRE(multiply.size() == 2);
+	CHECK(Neat::get_function("Namespace::NamespacedFunction") != nullptr);
+
+	std::array<Neat::Any, 2> args{ 6, 7 };
+	auto result = multiply[0]->invoke(args);
+	REQUIRE(result.has_value());
+	auto result_int = result.value_ptr<int>();
+	REQUIRE(result_int != nullptr);
+	CHECK(*result_int == 42);
+
+	// Static members
+	const Neat::Function* twice = Neat::get_function("MethodTester::twice");
+	REQUIRE(twice != nullptr);
+	std::array<Neat::Any, 1> twice_args{ 21 };
+	auto twice_result = twice->invoke(twice_args);
+	REQUIRE(twice_result.value_ptr<int>() != nullptr);
+	CHECK(*twice_result.value_ptr<int>() == 42);
+
+	const Neat::Variable* instance_count = Neat::get_variable("MethodTester::instance_count");
+	REQUIRE(instance_count != nullptr);
+	CHECK(instance_count->address == &MethodTester::instance_count);
+
+	const Neat::Variable* module_counter_variable = Neat::get_variable("module_counter");
+	REQUIRE(module_counter_variable != nullptr);
+	CHECK(module_counter_variable->type == Neat::get_id<int>());
+	module_counter_variable->set_value(5);
+	CHECK(module_counter == 5);
+}
@@ -0,0 +1,102 @@
+#include "catch2/catch_all.hpp"
+#include "neat/PointerView.h"
+#include "neat/Reflection.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+
+
+struct PointerViewTestBase { virtual ~PointerViewTestBase() = default; int base_value = 1; };
+struct PointerViewTestPadding { double padding = 0.0; };
+struct PointerViewTestDerived : PointerViewTestPadding, PointerViewTestBase { int derived_value = 2; };
+struct PointerViewTestNode { int value = 0; std::unique_ptr<PointerViewTestNode> next; };
+
+TEST_CASE("Pointer types are recognised")
+{
+	CHECK(Neat::get_pointer_operations<int*>() != nullptr);
+	CHECK(Neat::get_pointer_operations<const int*>() != nullptr);
+	CHECK(Neat::get_pointer_operations<std::optional<std::string>>() != nullptr);
+	CHECK(Neat::get_pointer_operations<std::unique_ptr<int>>() != nullptr);
+	CHECK(Neat::get_pointer_operations<std::shared_ptr<int>>() != nullptr);
+	CHECK(Neat::get_pointer_operations<int>() == nullptr);
+	CHECK(Neat::get_pointer_operations<void (*)()>() == nullptr);
+	CHECK(Neat::get_pointer_operations<std::unique_ptr<int[]>>() == nullptr);
+
+	CHECK(Neat::get_pointer_operations<int*>()->emplace == nullptr);
+	CHECK(!Neat::get_pointer_operations<int*>()->is_owning);
+	CHECK(Neat::get_pointer_operations<std::shared_ptr<int>>()->kind == Neat::PointerKind::SharedPtr);
+}
+
+TEST_CASE("PointerView over optionals and smart pointers")
+{
+	std::optional<std::string> name{};
+	auto name_view = Neat::PointerView::create(name);
+	CHECK(name_view.pointee_type() == Neat::get_id<std::string>());
+	CHECK(!name_view.has_value());
+	CHECK(name_view.get().value_ptr == nullptr);
+
+	Neat::AnyPtr emplaced = name_view.emplace();
+	REQUIRE(name.has_value());
+	CHECK(emplaced.value_ptr == &*name);
+	CHECK(emplaced.type_id == Neat::get_id<std::string>());
+
+	name_view.reset();
+	CHECK(!name.has_value());
+
+	std::shared_ptr<int> shared = std::make_shared<int>(5);
+	auto shared_view = Neat::PointerView::create(shared);
+	CHECK(shared_view.get().value_ptr == shared.get());
+	shared_view.reset();
+	CHECK(shared == nullptr);
+	shared_view.emplace();
+	REQUIRE(shared != nullptr);
+	CHECK(*shared == 0);
+
+	int value = 3;
+	const int* raw = &value;
+	auto raw_view = Neat::PointerView::create(raw);
+	CHECK(raw_view.get().value_ptr == &value);
+	CHECK(raw_view.get().type_id == Neat::get_id<int>());
+	CHECK(!raw_view.can_emplace());
+	raw_view.reset();
+	CHECK(raw == nullptr);
+	CHECK(value == 3);
+}
+
+TEST_CASE("PointerView reports the dynamic type of polymorphic pointees")
+{
+	Neat::add_type(Neat::Type::create<PointerViewTestBase>("PointerViewTestBase", Neat::get_id<PointerViewTestBase>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<PointerViewTestDerived>("PointerViewTestDerived", Neat::get_id<PointerViewTestDerived>(), {}, {}, {}, {}, {}));
+	Neat::add_type(Neat::Type::create<std::unique_ptr<PointerViewTestBase>>("std::unique_ptr<PointerViewTestBase>", Neat::get_id<std::unique_ptr<PointerViewTestBase>>(), {}, {}, {}, {}, {}));
+
+	CHECK(Neat::get_type(typeid(PointerViewTestDerived)) == Neat::get_type<PointerViewTestDerived>());
+	CHECK(Neat::get_type(typeid(int)) == nullptr);
+
+	auto derived = std::make_unique<PointerViewTestDerived>();
+	PointerViewTestDerived* derived_address = derived.get();
+	std::unique_ptr<PointerViewTestBase> base = std::move(derived);
+
+	auto view = Neat::PointerView::create(Neat::AnyPtr{ &base, Neat::get_id<std::unique_ptr<PointerViewTestBase>>() });
+	REQUIRE(view.is_valid());
+	CHECK(view.pointee_type() == Neat::get_id<PointerViewTestBase>());
+
+	Neat::AnyPtr pointee = view.get();
+	CHECK(pointee.type_id == Neat::get_id<PointerViewTestDerived>());
+	CHECK(pointee.value_ptr == derived_address); // Adjusted to the most derived object
+}
+
+TEST_CASE("PointerView follows a linked list")
+{
+	PointerViewTestNode head{ 1 };
+	head.next = std::make_unique<PointerViewTestNode>();
+	head.next->value = 2;
+
+	int sum = 0;
+	for (PointerViewTestNode* node = &head; node != nullptr;) {
+		sum += node->value;
+		Neat::AnyPtr next = Neat::PointerView::create(node->next).get();
+		node = static_cast<PointerViewTestNode*>(next.value_ptr);
+	}
+	CHECK(sum == 3);
+}
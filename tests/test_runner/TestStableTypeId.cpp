@@ -0,0 +1,69 @@
+#include "catch2/catch_all.hpp"
+#include "neat/Reflection.h"
+#include "neat/TemplateTypeId.h"
+
+
+struct StableTypeIdTestA {};
+struct StableTypeIdTestB {};
+
+TEST_CASE("Stable type ids are deterministic")
+{
+	static_assert(Neat::make_stable_type_id("game::Player") == Neat::make_stable_type_id("game::Player"));
+	static_assert(Neat::make_stable_type_id("game::Player") != Neat::make_stable_type_id("game::Enemy"));
+	static_assert(Neat::make_stable_type_id("") != Neat::c_empty_stable_type_id);
+
+	// 64 bit FNV-1a of "a"
+	CHECK(Neat::make_stable_type_id("a") == 0xaf63dc4c8601ec8cull);
+}
+
+TEST_CASE("Look up types by stable id")
+{
+	constexpr auto stable_id_a = Neat::make_stable_type_id("StableTypeIdTestA");
+	constexpr auto stable_id_b = Neat::make_stable_type_id("StableTypeIdTestB");
+
+	Neat::add_type(Neat::Type::create<StableTypeIdTestA>("StableTypeIdTestA", Neat::get_id<StableTypeIdTestA>(), {}, {}, {}, {}, {}));
+	CHECK(Neat::set_stable_id(Neat::get_id<StableTypeIdTestA>(), stable_id_a));
+	CHECK(Neat::set_stable_id(Neat::get_id<StableTypeIdTestA>(), stable_id_a)); // Registering the same id again is fine
+
+	// Types can also come with their stable id already set
+	auto type_b = Neat::Type::create<StableTypeIdTestB>("StableTypeIdTestB", Neat::get_id<StableTypeIdTestB>(), {}, {}, {}, {}, {});
+	type_b.stable_id = stable_id_b;
+	Neat::add_type(std::move(type_b));
+
+	const Neat::Type* a = Neat::get_type_by_stable_id(stable_id_a);
+	REQUIRE(a != nullptr);
+	CHECK(a->id == Neat::get_id<StableTypeIdTestA>());
+	CHECK(a->stable_id == stable_id_a);
+
+	const Neat::Type* b = Neat::get_type_by_stable_id(stable_id_b);
+	REQUIRE(b != nullptr);
+	CHECK(b->id == Neat::get_id<StableTypeIdTestB>());
+
+	CHECK(Neat::get_type_by_stable_id(Neat::make_stable_type_id("StableTypeIdTestC")) == nullptr);
+}
+
+struct StableTypeIdTestReloaded { virtual ~StableTypeIdTestReloaded() = default; };
+struct StableTypeIdTestReloadedV2 { virtual ~StableTypeIdTestReloadedV2() = default; };
+
+TEST_CASE("Replaced types drop their old lookup keys")
+{
+	constexpr auto old_stable_id = Neat::make_stable_type_id("StableTypeIdTestReloaded");
+	constexpr auto new_stable_id = Neat::make_stable_type_id("StableTypeIdTestReloadedV2");
+
+	auto type = Neat::Type::create<StableTypeIdTestReloaded>("StableTypeIdTestReloaded", Neat::get_id<StableTypeIdTestReloaded>(), {}, {}, {}, {}, {});
+	type.stable_id = old_stable_id;
+	Neat::add_type(std::move(type));
+	REQUIRE(Neat::get_type(typeid(StableTypeIdTestReloaded)) != nullptr);
+
+	// A reloaded module brings a new stable id and a new `type_info`
+	auto reloaded = Neat::Type::create<StableTypeIdTestReloaded>("StableTypeIdTestReloaded", Neat::get_id<StableTypeIdTestReloaded>(), {}, {}, {}, {}, {});
+	reloaded.stable_id = new_stable_id;
+	reloaded.type_info = &typeid(StableTypeIdTestReloadedV2);
+	const Neat::Type& replaced = Neat::replace_type(std::move(reloaded));
+
+	CHECK(replaced.stable_id == new_stable_id);
+	CHECK(Neat::get_type_by_stable_id(new_stable_id) == &replaced);
+	CHECK(Neat::get_type_by_stable_id(old_stable_id) == nullptr);
+	CHECK(Neat::get_type(typeid(StableTypeIdTestReloadedV2)) == &replaced);
+	CHECK(Neat::get_type(typeid(StableTypeIdTestReloaded)) == nullptr);
+}
@@ -1,6 +1,7 @@
 #include "catch2/catch_all.hpp"
 #include "neat/TemplateTypeId.h"
 
+#include <string_view>
 #include <type_traits>
 
 
@@ -39,3 +40,25 @@ TEST_CASE("Neat::get_id() with manual id override")
 	const auto c_id = Neat::get_id<SomeStructC>();
 	CHECK(c_id == c_manual_id_number);
 }
+
+TEST_CASE("Neat::get_id() returns reserved compile time id's for fundamental types")
+{
+	static_assert(Neat::get_id<int>() == Neat::FixedTypeId<int>::value);
+	static_assert(Neat::get_id<void>() != Neat::c_empty_type_id);
+	static_assert(Neat::get_id<float>() < Neat::c_first_generated_type_id);
+	static_assert(Neat::get_id<int>() != Neat::get_id<unsigned int>());
+
+	// Usable as case labels
+	const auto name_of = [](Neat::TemplateTypeId id) {
+		switch (id) {
+		case Neat::get_id<bool>(): return "bool";
+		case Neat::get_id<double>(): return "double";
+		default: return "other";
+		}
+	};
+	CHECK(std::string_view{ name_of(Neat::get_id<double>()) } == "double");
+	CHECK(std::string_view{ name_of(Neat::get_id<SomeStructA>()) } == "other");
+
+	CHECK(Neat::get_id<SomeStructA>() >= Neat::c_first_generated_type_id);
+	CHECK(Neat::get_id<const int>() != Neat::get_id<int>());
+}
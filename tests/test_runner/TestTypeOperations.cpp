@@ -0,0 +1,95 @@
+#include "catch2/catch_all.hpp"
+#include "neat/Reflection.h"
+
+#include <array>
+#include <string>
+
+
+struct TypeOperationsTrivialType
+{
+	int a;
+	float b;
+};
+
+struct TypeOperationsNonTrivialType
+{
+	int a = 7;
+	std::string s = "A string which doesn't fit in the small string buffer";
+};
+
+template<typename T>
+static Neat::Type create_type_operations_type(std::string_view name)
+{
+	return Neat::Type::create<T>(name, Neat::get_id<T>(), {}, {}, {}, {}, {});
+}
+
+TEST_CASE("Type flags")
+{
+	auto trivial = create_type_operations_type<TypeOperationsTrivialType>("TypeOperationsTrivialType");
+	CHECK(trivial.has_flags(Neat::TypeFlags::TriviallyDefaultConstructible | Neat::TypeFlags::TriviallyCopyable
+		| Neat::TypeFlags::TriviallyDestructible | Neat::TypeFlags::TriviallyRelocatable));
+
+	auto non_trivial = create_type_operations_type<TypeOperationsNonTrivialType>("TypeOperationsNonTrivialType");
+	CHECK(!non_trivial.has_flags(Neat::TypeFlags::TriviallyDefaultConstructible));
+	CHECK(!non_trivial.has_flags(Neat::TypeFlags::TriviallyCopyable));
+	CHECK(!non_trivial.has_flags(Neat::TypeFlags::TriviallyDestructible));
+	CHECK(!non_trivial.has_flags(Neat::TypeFlags::TriviallyRelocatable));
+}
+
+TEST_CASE("Type bulk operations on trivial types")
+{
+	auto type = create_type_operations_type<TypeOperationsTrivialType>("TypeOperationsTrivialType");
+	REQUIRE(type.construct_n != nullptr);
+	REQUIRE(type.copy_n != nullptr);
+
+	std::array<TypeOperationsTrivialType, 4> source{};
+	for (auto& element : source) {
+		element = TypeOperationsTrivialType{ 5, 1.5f };
+	}
+	type.construct_n({ source.data(), type.id }, 2);
+	CHECK(source[0].a == 0);
+	CHECK(source[1].b == 0.0f);
+	CHECK(source[2].a == 5);
+
+	std::array<TypeOperationsTrivialType, 4> destination{};
+	type.copy_n({ destination.data(), type.id }, { source.data(), type.id }, 4);
+	CHECK(destination[0].a == 0);
+	CHECK(destination[3].a == 5);
+	CHECK(destination[3].b == 1.5f);
+}
+
+TEST_CASE("Type bulk operations on non trivial types")
+{
+	auto type = create_type_operations_type<TypeOperationsNonTrivialType>("TypeOperationsNonTrivialType");
+	REQUIRE(type.construct_n != nullptr);
+	REQUIRE(type.destroy_n != nullptr);
+	REQUIRE(type.copy_n != nullptr);
+	REQUIRE(type.move_n != nullptr);
+	REQUIRE(type.relocate_n != nullptr);
+
+	constexpr size_t c_count = 3;
+	alignas(TypeOperationsNonTrivialType) std::byte buffer_a[sizeof(TypeOperationsNonTrivialType) * c_count];
+	alignas(TypeOperationsNonTrivialType) std::byte buffer_b[sizeof(TypeOperationsNonTrivialType) * c_count];
+	alignas(TypeOperationsNonTrivialType) std::byte buffer_c[sizeof(TypeOperationsNonTrivialType) * c_count];
+	auto* objects_a = reinterpret_cast<TypeOperationsNonTrivialType*>(buffer_a);
+	auto* objects_b = reinterpret_cast<TypeOperationsNonTrivialType*>(buffer_b);
+	auto* objects_c = reinterpret_cast<TypeOperationsNonTrivialType*>(buffer_c);
+
+	type.construct_n({ objects_a, type.id }, c_count);
+	CHECK(objects_a[2].a == 7);
+	objects_a[1].s = "Changed";
+
+	type.copy_n({ objects_b, type.id }, { objects_a, type.id }, c_count);
+	CHECK(objects_b[1].s == "Changed");
+	CHECK(objects_a[1].s == "Changed");
+
+	type.move_n({ objects_c, type.id }, { objects_a, type.id }, c_count);
+	CHECK(objects_c[1].s == "Changed");
+	type.destroy_n({ objects_a, type.id }, c_count); // Moved from objects still need to be destroyed
+
+	type.relocate_n({ objects_a, type.id }, { objects_c, type.id }, c_count);
+	CHECK(objects_a[1].s == "Changed");
+
+	type.destroy_n({ objects_a, type.id }, c_count);
+	type.destroy_n({ objects_b, type.id }, c_count);
+}
@@ -0,0 +1,67 @@
+#include "catch2/catch_all.hpp"
+#include "neat/Reflection.h"
+
+
+struct VersionedTypeIdTestHost { int i; };
+struct VersionedTypeIdTestPlugin { int i; };
+struct VersionedTypeIdTestUnregistered {};
+
+constexpr Neat::ModuleTag c_test_plugin_tag = 7;
+
+static const Neat::Type& register_versioned_type_id_test_plugin_type()
+{
+	auto type = Neat::Type::create<VersionedTypeIdTestPlugin>("VersionedTypeIdTestPlugin", Neat::get_id<VersionedTypeIdTestPlugin>(), {}, {}, {}, {}, {});
+	type.module_tag = c_test_plugin_tag;
+	return Neat::add_type(std::move(type));
+}
+
+TEST_CASE("VersionedTypeId layout")
+{
+	constexpr auto id = Neat::VersionedTypeId::create(1234, 5, 6);
+	static_assert(id.index() == 1234);
+	static_assert(id.generation() == 5);
+	static_assert(id.module_tag() == 6);
+	static_assert(!id.is_empty());
+	static_assert(Neat::VersionedTypeId{}.is_empty());
+}
+
+TEST_CASE("Versioned ids of registered types")
+{
+	Neat::add_type(Neat::Type::create<VersionedTypeIdTestHost>("VersionedTypeIdTestHost", Neat::get_id<VersionedTypeIdTestHost>(), {}, {}, {}, {}, {}));
+
+	const auto id = Neat::get_versioned_id(Neat::get_id<VersionedTypeIdTestHost>());
+	CHECK(id.index() == Neat::get_id<VersionedTypeIdTestHost>());
+	CHECK(id.module_tag() == Neat::c_empty_module_tag);
+	CHECK(Neat::is_current(id));
+	REQUIRE(Neat::get_type(id) != nullptr);
+	CHECK(Neat::get_type(id)->name == "VersionedTypeIdTestHost");
+
+	CHECK(Neat::get_versioned_id(Neat::get_id<VersionedTypeIdTestUnregistered>()).is_empty());
+	CHECK(!Neat::is_current(Neat::VersionedTypeId{}));
+}
+
+TEST_CASE("Replaced types invalidate cached versioned ids")
+{
+	register_versioned_type_id_test_plugin_type();
+
+	const auto cached = Neat::get_versioned_id(Neat::get_id<VersionedTypeIdTestPlugin>());
+	REQUIRE(Neat::is_current(cached));
+	CHECK(cached.module_tag() == c_test_plugin_tag);
+
+	auto reloaded = Neat::Type::create<VersionedTypeIdTestPlugin>("VersionedTypeIdTestPlugin", Neat::get_id<VersionedTypeIdTestPlugin>(), {}, {}, {}, {}, {});
+	reloaded.module_tag = c_test_plugin_tag;
+	const Neat::Type& replaced = Neat::replace_type(std::move(reloaded));
+	CHECK(replaced.generation == Neat::TypeGeneration(cached.generation() + 1));
+
+	CHECK(!Neat::is_current(cached));
+	CHECK(Neat::get_type(cached) == nullptr);
+	CHECK(Neat::get_type(Neat::get_id<VersionedTypeIdTestPlugin>()) == &replaced); // Plain lookups still work
+
+	const auto current = Neat::get_versioned_id(Neat::get_id<VersionedTypeIdTestPlugin>());
+	CHECK(current.index() == cached.index());
+	CHECK(Neat::is_current(current));
+
+	Neat::invalidate_module(c_test_plugin_tag);
+	CHECK(!Neat::is_current(current));
+	CHECK(Neat::is_current(Neat::get_versioned_id(Neat::get_id<VersionedTypeIdTestPlugin>())));
+}
@@ -7,6 +7,7 @@
 #include "reflifc/Type.h"
 #include "reflifc/Name.h"
 #include "reflifc/decl/AliasDeclaration.h"
+#include "reflifc/decl/Function.h"
 #include "ifc/Environment.h"
 #include "ifc/DeclarationFwd.h"
 
@@ -60,6 +61,7 @@ std::string_view render_as_neat_access_enum(ifc::Access access, std::string_view
 bool is_member_publicly_accessible(reflifc::Field field_declaration, ifc::TypeBasis type, bool reflects_private_members, reflifc::Module root_module, RecursionContextArg ctx);
 bool is_member_publicly_accessible(reflifc::Method method_declaration, ifc::TypeBasis type, bool reflects_private_members, reflifc::Module root_module, RecursionContextArg ctx);
 bool is_member_publicly_accessible(reflifc::AliasDeclaration alias_declaration, ifc::TypeBasis type, bool reflects_private_members, reflifc::Module root_module, RecursionContextArg ctx);
+bool is_member_publicly_accessible(reflifc::Constructor constructor_declaration, ifc::TypeBasis type, reflifc::Module root_module, RecursionContextArg ctx);
 bool can_reflect_private_members(reflifc::Declaration type_decl, reflifc::Module root_module, RecursionContextArg ctx);
 bool is_type_visible_from_module(reflifc::Type type, reflifc::Module root_module, RecursionContextArg ctx);
 bool is_type_visible_from_module(reflifc::MethodType method, reflifc::Module root_module, RecursionContextArg ctx);
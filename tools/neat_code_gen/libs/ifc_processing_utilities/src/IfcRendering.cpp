@@ -444,6 +444,14 @@ std::string render_refered_declaration(reflifc::Declaration decl, RecursionConte
 		auto enumeration = decl.as_enumeration();
 		return enumeration.name();
 	}
+	case ifc::DeclSort::Variable:
+	{
+		auto name = get_declaration_name(decl, ctx);
+		if (!name) {
+			throw ContextualException{ "Cannot render the name of a variable declaration." };
+		}
+		return std::string{ *name };
+	}
 	default:
 		throw ContextualException{ std::format("Cannot render a refered declaration with unsupported DeclSort: {}.",
 			decl_sort_to_string(kind)) };
@@ -543,6 +551,34 @@ bool is_member_publicly_accessible(reflifc::Method method_declaration, ifc::Type
 	return (member_access == Neat::Access::Public || reflects_private_members);
 }
 
+bool is_member_publicly_accessible(reflifc::Constructor constructor_declaration, ifc::TypeBasis type, reflifc::Module root_module, RecursionContextArg ctx)
+{
+	const auto parameters = constructor_declaration.type().parameters();
+	if (!std::ranges::all_of(parameters, [root_module, &ctx](reflifc::Type parameter) { return is_type_visible_from_module(parameter, root_module, ctx); }))
+	{
+		return false;
+	}
+
+	Neat::Access default_access;
+	switch (type)
+	{
+	case ifc::TypeBasis::Class:
+		default_access = Neat::Access::Private;
+		break;
+	case ifc::TypeBasis::Struct:
+		default_access = Neat::Access::Public;
+		break;
+	default:
+		throw ContextualException(std::format("Expected a constructor to be part of a Class or a Struct, but it's part of a {} instead.",
+			type_basis_to_string(type)));
+	}
+
+	const Neat::Access member_access = convert_access_enum(constructor_declaration.access()).value_or(default_access);
+
+	// Private constructors can't be reached, even with reflect_privates, as `Constructor::create` needs `std::is_constructible`.
+	return member_access == Neat::Access::Public;
+}
+
 bool is_member_publicly_accessible(reflifc::AliasDeclaration alias_declaration, ifc::TypeBasis type, bool reflects_private_members, reflifc::Module root_module, RecursionContextArg ctx)
 {
 	if (!is_type_visible_from_module(alias_declaration.aliasee(), root_module, ctx)) {
@@ -24,6 +24,7 @@
 #include "reflifc/decl/Parameter.h"
 #include "reflifc/decl/TemplateDeclaration.h"
 #include "reflifc/decl/UsingDeclaration.h"
+#include "reflifc/decl/Variable.h"
 #include "reflifc/type/Array.h"
 #include "reflifc/type/Base.h"
 #include "reflifc/type/Forall.h"
@@ -41,9 +42,10 @@
 using namespace std::string_literals;
 using namespace std::string_view_literals;
 
-CodeGenerator::CodeGenerator(const ifc::File& ifc_file, ifc::Environment& environment)
+CodeGenerator::CodeGenerator(const ifc::File& ifc_file, ifc::Environment& environment, bool emit_stable_ids)
 	: ifc_file(&ifc_file)
 	, environment(&environment)
+	, emit_stable_ids(emit_stable_ids)
 {
 	code.reserve(4096);
 }
@@ -108,11 +110,41 @@ void CodeGenerator::write_cpp_file(reflifc::Module module, std::ostream& out)
 		}
 	}
 
+	{
+		ContextArea render_area{ "While rendering enums."sv };
+		for (const auto& reflectable_enum : reflectable_types.enums) {
+			try {
+				render(reflectable_enum.second);
+			} catch (ContextualException& e) {
+				std::cout << "Warning: Could not render enum. Reason: " << e.what() << '\n';
+			}
+		}
+	}
+
+	{
+		ContextArea render_area{ "While rendering functions and variables."sv };
+		for (const auto& function : reflectable_types.functions) {
+			try {
+				render(function);
+			} catch (ContextualException& e) {
+				std::cout << "Warning: Could not render function. Reason: " << e.what() << '\n';
+			}
+		}
+		for (const auto& variable : reflectable_types.variables) {
+			try {
+				render(variable);
+			} catch (ContextualException& e) {
+				std::cout << "Warning: Could not render variable. Reason: " << e.what() << '\n';
+			}
+		}
+	}
+
 	// Write the generated code to the output stream
 	out << std::format(
 R"(module;
 #include "Neat/Reflection.h"
 #include "Neat/TemplateTypeId.h"
+#include "Neat/Enum.h"
 module {0};
 
 // ================================================================================
@@ -156,6 +188,12 @@ void CodeGenerator::scan(reflifc::Declaration decl, RecursionContextArg ctx, Ref
 {
 	if (decl.is_scope())
 		scan(decl.as_scope(), decl, ctx, out_types);
+	else if (decl.sort() == ifc::DeclSort::Enumeration && is_type_visible_from_module(decl, reflifc::Module{ ifc_file }, ctx))
+		collect_enum(decl, ctx, out_types);
+	else if (decl.sort() == ifc::DeclSort::Function && is_type_visible_from_module(decl, reflifc::Module{ ifc_file }, ctx))
+		collect_function(decl.as_function(), render_full_typename(decl, ctx), ctx, out_types);
+	else if (decl.sort() == ifc::DeclSort::Variable && is_type_visible_from_module(decl, reflifc::Module{ ifc_file }, ctx))
+		collect_variable(decl.as_variable(), render_full_typename(decl, ctx), ctx, out_types);
 }
 
 void CodeGenerator::scan(reflifc::ScopeDeclaration scope_decl, reflifc::Declaration decl, RecursionContextArg ctx, ReflectableTypes& out_types)
@@ -372,6 +410,62 @@ void CodeGenerator::scan(reflifc::TemplateId template_id, RecursionContextArg ct
 	}
 }
 
+void CodeGenerator::collect_enum(reflifc::Declaration decl, RecursionContextArg ctx, ReflectableTypes& out_types)
+{
+	// Did we already visit this declaration?
+	if (out_types.enums.contains(decl)) {
+		return;
+	}
+
+	ReflectableEnum reflectable_enum{};
+	reflectable_enum.type_name = render_full_typename(decl, ctx);
+
+	// Only the names are needed, the values are computed by the compiler from `Enum::Name` in the generated code.
+	for (auto enumerator : decl.as_enumeration().enumerators()) {
+		reflectable_enum.enumerator_names.emplace_back(enumerator.name());
+	}
+
+	out_types.enums.insert({ decl, std::move(reflectable_enum) });
+}
+
+void CodeGenerator::collect_function(reflifc::Function function, std::string qualified_name, RecursionContextArg ctx, ReflectableTypes& out_types)
+{
+	// Only reflect functions whose signature is visible from the module.
+	if (!is_type_visible_from_module(function.type(), reflifc::Module{ ifc_file }, ctx)) {
+		return;
+	}
+
+	out_types.functions.push_back({ function, std::move(qualified_name), ctx.template_argument_sets });
+
+	// Make sure to reflect the function's return type and parameter types too
+	try {
+		scan(function.type().return_type(), ctx, out_types);
+		for (auto param : function.type().parameters()) {
+			scan(param, ctx, out_types);
+		}
+	} catch (ContextualException&) { /* It's safe to ignore the error here :) */ }
+}
+
+void CodeGenerator::collect_variable(reflifc::Variable variable, std::string qualified_name, RecursionContextArg ctx, ReflectableTypes& out_types)
+{
+	// Only reflect variables whose type is visible from the module, and which aren't references.
+	if (is_reference_type(variable.type(), ctx) || !is_type_visible_from_module(variable.type(), reflifc::Module{ ifc_file }, ctx)) {
+		return;
+	}
+
+	out_types.variables.push_back({ variable, std::move(qualified_name), ctx.template_argument_sets });
+
+	// Make sure to reflect the variable's type too
+	try {
+		scan(variable.type(), ctx, out_types);
+	} catch (ContextualException&) { /* It's safe to ignore the error here :) */ }
+}
+
+static bool is_public_member(ifc::Access access, ifc::Access default_access)
+{
+	return (access == ifc::Access::None ? default_access : access) == ifc::Access::Public;
+}
+
 void CodeGenerator::collect_class_members(reflifc::Declaration decl, reflifc::ClassOrStruct scope_decl, RecursionContextArg ctx, ReflectableType& inout_type, ReflectableTypes& out_other_types)
 {
 	bool reflect_privates;
@@ -415,6 +509,10 @@ void CodeGenerator::collect_class_members(reflifc::Declaration decl, reflifc::Cl
 		{
 			const auto method = decl.as_method();
 
+			if (ifc::has_trait(method.traits(), ifc::FunctionTraits::PureVirtual)) {
+				inout_type.is_abstract = true;
+			}
+
 			try {
 				// Reflect only methods neat reflection can reach (public, or with reflect_privates enabled).
 				// Also exclude conversion operators, as you cannot take the pointer to address.
@@ -439,6 +537,64 @@ void CodeGenerator::collect_class_members(reflifc::Declaration decl, reflifc::Cl
 			}
 			break;
 		}
+		case ifc::DeclSort::Enumeration: // Nested enum
+		{
+			try {
+				if (is_public_member(decl.as_enumeration().access(), inout_type.default_access)) {
+					collect_enum(decl, ctx, out_other_types);
+				}
+			} catch (ContextualException&) { /* If NeatReflection fails to understand the enum, it's skipped */ }
+			break;
+		}
+		case ifc::DeclSort::Function: // Static member function
+		{
+			const auto function = decl.as_function();
+
+			try {
+				// Function pointers to private static members can't be taken from the generated code, so only public ones are reflected.
+				if (is_public_member(function.access(), inout_type.default_access)) {
+					collect_function(function, std::format("{}::{}", inout_type.type_name, render_name(function.name(), ctx)), ctx, out_other_types);
+				}
+			} catch (ContextualException&) { /* If NeatReflection fails to understand the function, it's skipped */ }
+			break;
+		}
+		case ifc::DeclSort::Variable: // Static member variable
+		{
+			const auto variable = decl.as_variable();
+
+			try {
+				if (is_public_member(variable.access(), inout_type.default_access)) {
+					collect_variable(variable, std::format("{}::{}", inout_type.type_name, variable.name()), ctx, out_other_types);
+				}
+			} catch (ContextualException&) { /* If NeatReflection fails to understand the variable, it's skipped */ }
+			break;
+		}
+		case ifc::DeclSort::Constructor:
+		{
+			const auto constructor = decl.as_constructor();
+
+			try {
+				// Reflect only public constructors, copy and move constructors are added by the runtime if they aren't declared.
+				// Deleted constructors can't be called, `Constructor::create` would only register them without a construct function.
+				if (!ifc::has_trait(constructor.traits(), ifc::FunctionTraits::Deleted)
+					&& is_member_publicly_accessible(constructor, scope_decl.kind(), reflifc::Module{ ifc_file }, ctx)) {
+					// Mark this constructor as reflectable
+					inout_type.constructors.push_back({ constructor, true });
+
+					// Make sure to reflect the constructor's parameter types too
+					try {
+						auto params = constructor.type().parameters();
+						for (auto param : params) {
+							scan(param, ctx, out_other_types);
+						}
+					} catch (ContextualException&) { /* It's safe to ignore the error here :) */ }
+				}
+			} catch (ContextualException& e) {
+				// If NeatReflection fails to understand the type, we mark this constructor as not reflectable.
+				inout_type.constructors.push_back({ constructor, false, e.what() });
+			}
+			break;
+		}
 		case ifc::DeclSort::Alias:
 		{
 			const auto alias = decl.as_alias();
@@ -491,13 +647,17 @@ void CodeGenerator::render(const ifc::FundamentalType& type)
 	if (type.basis == ifc::TypeBasis::Void) {
 		code += R"(add_type(Type{ .name="void", .id=get_id<void>(), .size=0 });
 )"sv;
+		code += render_stable_id("void");
 		return;
 	}
 
 	auto type_name = render_full_typename(type);
 
-	code += std::format(R"(add_type(Type{{ .name="{0}", .id=get_id<{0}>(), .size=sizeof({0}) }});
+	// get_id<> of a fundamental type is a reserved compile time constant, see `FixedTypeId`.
+	// Go through Type::create, so fundamental types get the same constructors and value operations as other types.
+	code += std::format(R"(add_type(Type::create<{0}>("{0}", get_id<{0}>(), {{}}, {{}}, {{}}, {{}}, {{}}));
 )", type_name);
+	code += render_stable_id(type_name);
 }
 
 void CodeGenerator::render(ReflectableType& type, bool is_templated_type)
@@ -526,6 +686,19 @@ void CodeGenerator::render(ReflectableType& type, bool is_templated_type)
 		}
 	}
 
+	// Abstract classes can't be constructed. Pure virtual methods inherited from a base aren't seen here,
+	// for those `Constructor::create` registers the constructors without a construct function.
+	std::string constructors;
+	constructors.reserve(32 * type.constructors.size());
+	for (auto& constructor : type.constructors) {
+		if (constructor.is_reflectable && !type.is_abstract) {
+			constructors += render_constructor(type.type_name, type.default_access, constructor.ifc_constructor, ctx);
+			constructors += ", ";
+		} else {
+			// TODO: Write warning about unreflectable constructor.
+		}
+	}
+
 	std::string bases;
 	bases.reserve(32 * type.bases.size());
 	for (auto& base_class : type.bases) {
@@ -566,9 +739,60 @@ void CodeGenerator::render(ReflectableType& type, bool is_templated_type)
 	{{ {2} }},
 	{{ {3} }},
 	{{ {4} }},
-	{{ {5} }}
+	{{ {5} }},
+	{{ {6} }}
 ));
-)", type.type_name, bases, fields, methods, aliases, template_arguments);
+)", type.type_name, bases, fields, methods, aliases, template_arguments, constructors);
+	code += render_stable_id(type.type_name);
+}
+
+void CodeGenerator::render(const ReflectableEnum& enum_)
+{
+	std::string enumerators;
+	enumerators.reserve(32 * enum_.enumerator_names.size());
+	for (const auto& enumerator_name : enum_.enumerator_names) {
+		enumerators += std::format(R"({{ "{1}", {0}::{1} }}, )", enum_.type_name, enumerator_name);
+	}
+
+	code += std::format(R"(add_type(Type::create<{0}>("{0}", get_id<{0}>(), {{}}, {{}}, {{}}, {{}}, {{}}));
+add_enum(Enum::create<{0}>("{0}", {{ {1} }}));
+)", enum_.type_name, enumerators);
+	code += render_stable_id(enum_.type_name);
+}
+
+void CodeGenerator::render(const ReflectableFunction& function)
+{
+	const RecursionContext ctx{ environment, function.templates_context };
+
+	const auto function_type = function.ifc_function.type();
+	const auto return_type = render_full_typename(function_type.return_type(), ctx);
+	const auto params = render_full_typename_list(function_type.parameters(), ctx);
+	const auto begin_params_delimiter = (params.empty() ? ""sv : ", "sv);
+
+	// Cast the function pointer, so overloads are resolved to the reflected signature.
+	code += std::format(R"(add_function(Function::create<static_cast<{1} (*)({3})>(&{0}), {1}{2}{3}>("{0}"));
+)", function.qualified_name, return_type, begin_params_delimiter, params);
+}
+
+void CodeGenerator::render(const ReflectableVariable& variable)
+{
+	const RecursionContext ctx{ environment, variable.templates_context };
+
+	const auto variable_type = render_full_typename(variable.ifc_variable.type(), ctx);
+
+	code += std::format(R"(add_variable(Variable::create<{1}, &{0}>("{0}"));
+)", variable.qualified_name, variable_type);
+}
+
+std::string CodeGenerator::render_stable_id(std::string_view type_name) const
+{
+	if (!emit_stable_ids) {
+		return {};
+	}
+
+	// Hashed here, so the id is a literal in the generated code and doesn't depend on the order types are used in.
+	return std::format(R"(set_stable_id(get_id<{0}>(), 0x{1:016x}ull);
+)", type_name, Neat::make_stable_type_id(type_name));
 }
 
 std::string CodeGenerator::render_field(std::string_view outer_class_type, ifc::Access default_access, const reflifc::Field& field, RecursionContextArg ctx) const
@@ -593,6 +817,15 @@ std::string CodeGenerator::render_method(std::string_view outer_class_type, ifc:
 	return std::format(R"(Method::create<({6})&{0}::{4}, {0}, {1}{2}{3}>("{4}", {5}))", outer_class_type, return_type, begin_params_delimiter, params, name, access, method_ptr_type);
 }
 
+std::string CodeGenerator::render_constructor(std::string_view outer_class_type, ifc::Access default_access, const reflifc::Constructor& constructor, RecursionContextArg ctx) const
+{
+	const auto params = render_full_typename_list(constructor.type().parameters(), ctx);
+	const auto begin_params_delimiter = (params.empty() ? ""sv : ", "sv);
+	const auto access = render_as_neat_access_enum(constructor.access(), default_access);
+
+	return std::format(R"(Constructor::create<{0}{1}{2}>({3}))", outer_class_type, begin_params_delimiter, params, access);
+}
+
 std::string CodeGenerator::render_base_class(std::string_view outer_class_type, ifc::Access default_access, const reflifc::BaseType& base_class, RecursionContextArg ctx) const
 {
 	// If outer type is a class or struct, the default access is private or public
@@ -600,6 +833,12 @@ std::string CodeGenerator::render_base_class(std::string_view outer_class_type,
 
 	auto type_name = render_full_typename(base_class.type, ctx);
 
+	// Generated code can only upcast to public bases
+	const auto access = (base_class.access == ifc::Access::None ? default_access : base_class.access);
+	if (access == ifc::Access::Public) {
+		return std::format(R"(BaseClass::create<{0}, {1}>({2}))", outer_class_type, type_name, access_string);
+	}
+
 	return std::format(R"(BaseClass{{ get_id<{0}>(), {1} }})", type_name, access_string);
 }
 
@@ -21,6 +21,7 @@
 #include "reflifc/decl/ClassOrStruct.h"
 #include "reflifc/decl/Field.h"
 #include "reflifc/decl/Function.h"
+#include "reflifc/decl/Variable.h"
 #include "reflifc/type/Base.h"
 #include "reflifc/type/Function.h"
 #include "reflifc/TemplateId.h"
@@ -35,7 +36,7 @@ namespace ifc
 class CodeGenerator
 {
 public:
-	CodeGenerator(const ifc::File& ifc_file, ifc::Environment& environment);
+	CodeGenerator(const ifc::File& ifc_file, ifc::Environment& environment, bool emit_stable_ids = false);
 
 	void write_cpp_file(reflifc::Module module, std::ostream& out);
 
@@ -54,6 +55,13 @@ private:
 		std::string failure_reason;
 	};
 
+	struct ReflectableConstructor
+	{
+		reflifc::Constructor ifc_constructor;
+		bool is_reflectable;
+		std::string failure_reason;
+	};
+
 	struct ReflectableAlias
 	{
 		reflifc::AliasDeclaration ifc_alias;
@@ -77,16 +85,41 @@ private:
 
 		std::vector<ReflectableField> fields;
 		std::vector<ReflectableMethod> methods;
+		std::vector<ReflectableConstructor> constructors;
 		std::vector<ReflectableAlias> aliases;
+		bool is_abstract = false; // Declares a pure virtual method, its constructors aren't reflected
 
 		RecursionContext::TemplateArgumentSets templates_context{};
 	};
 
+	struct ReflectableEnum
+	{
+		std::string type_name;
+		std::vector<std::string> enumerator_names;
+	};
+
+	struct ReflectableFunction
+	{
+		reflifc::Function ifc_function;
+		std::string qualified_name;
+		RecursionContext::TemplateArgumentSets templates_context{};
+	};
+
+	struct ReflectableVariable
+	{
+		reflifc::Variable ifc_variable;
+		std::string qualified_name;
+		RecursionContext::TemplateArgumentSets templates_context{};
+	};
+
 	struct ReflectableTypes
 	{
 		std::unordered_map<reflifc::Declaration, ReflectableType> types;
 		std::unordered_map<reflifc::TemplateId, ReflectableType> template_types;
 		std::unordered_set<reflifc::Type> fundamental_types; // Should be `ifc::FundamentalType*` but reflifc doesn't expose that yet.
+		std::unordered_map<reflifc::Declaration, ReflectableEnum> enums;
+		std::vector<ReflectableFunction> functions; // Free functions and static member functions
+		std::vector<ReflectableVariable> variables; // Module level variables and static member variables
 	};
 
 	void scan(reflifc::Scope scope_desc, RecursionContextArg ctx, ReflectableTypes& out_types);
@@ -96,12 +129,20 @@ private:
 	void scan(reflifc::Type type, RecursionContextArg ctx, ReflectableTypes& out_types);
 	void scan(reflifc::Expression expression, RecursionContextArg ctx, ReflectableTypes& out_types);
 	void scan(reflifc::TemplateId template_id, RecursionContextArg ctx, ReflectableTypes& out_types);
+	void collect_enum(reflifc::Declaration decl, RecursionContextArg ctx, ReflectableTypes& out_types);
+	void collect_function(reflifc::Function function, std::string qualified_name, RecursionContextArg ctx, ReflectableTypes& out_types);
+	void collect_variable(reflifc::Variable variable, std::string qualified_name, RecursionContextArg ctx, ReflectableTypes& out_types);
 	void collect_class_members(reflifc::Declaration decl, reflifc::ClassOrStruct scope_decl, RecursionContextArg ctx, ReflectableType& inout_type, ReflectableTypes& out_other_types);
 
 	void render(const ifc::FundamentalType& type);
 	void render(ReflectableType& type, bool is_templated_type);
+	void render(const ReflectableEnum& enum_);
+	void render(const ReflectableFunction& function);
+	void render(const ReflectableVariable& variable);
+	std::string render_stable_id(std::string_view type_name) const;
 	std::string render_field(std::string_view outer_class_type, ifc::Access default_access, const reflifc::Field& field, RecursionContextArg ctx) const;
 	std::string render_method(std::string_view outer_class_type, ifc::Access default_access, const reflifc::Method& method, RecursionContextArg ctx) const;
+	std::string render_constructor(std::string_view outer_class_type, ifc::Access default_access, const reflifc::Constructor& constructor, RecursionContextArg ctx) const;
 	std::string render_base_class(std::string_view outer_class_type, ifc::Access default_access, const reflifc::BaseType& base_class, RecursionContextArg ctx) const;
 	std::string render_member_alias(const reflifc::AliasDeclaration& member_alias, ifc::Access default_access, RecursionContextArg ctx) const;
 	std::string render_template_argument(const reflifc::Expression& template_arg, RecursionContextArg ctx) const;
@@ -110,4 +151,5 @@ private:
 	std::string code;
 	const ifc::File* ifc_file;
 	ifc::Environment* environment;
+	bool emit_stable_ids; // Register `make_stable_type_id()` of every type name
 };
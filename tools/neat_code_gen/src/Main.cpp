@@ -7,6 +7,7 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <string_view>
 #include <filesystem>
 #include <span>
 
@@ -16,7 +17,7 @@
 #include "reflifc/Module.h"
 
 
-bool convert_ifc_file(const std::filesystem::path& ifc_filename, const std::filesystem::path& cpp_filename) try
+bool convert_ifc_file(const std::filesystem::path& ifc_filename, const std::filesystem::path& cpp_filename, bool emit_stable_ids) try
 {
     ContextArea filename_context{ std::format("While loading ifc file: '{0}'. And preparing to output to: '{1}'", ifc_filename.string(), cpp_filename.string()) };
 
@@ -32,7 +33,7 @@ bool convert_ifc_file(const std::filesystem::path& ifc_filename, const std::file
         return false;
     }
 
-    CodeGenerator code_generator{ ifc_file, environment };
+    CodeGenerator code_generator{ ifc_file, environment, emit_stable_ids };
     code_generator.write_cpp_file(reflifc::Module{&ifc_file}, file_stream);
 
     return true;
@@ -52,12 +53,15 @@ struct CodeGenArgs
 {
     std::filesystem::path input_ifc_path;
     std::filesystem::path output_cpp_path;
+    bool emit_stable_ids = false;
 };
 
 bool parse_command_line_args(std::span<const char*> in_args, CodeGenArgs& out_parsed_args)
 {
     constexpr auto USAGE = R"(Usage: 
-    NeatReflectionCodeGen.exe <in_ifc_file> <out_cpp_file>)";
+    NeatReflectionCodeGen.exe <in_ifc_file> <out_cpp_file> [--stable-ids]
+
+    --stable-ids    Register a stable type id, a hash of the qualified type name, for every reflected type.)";
 
     if (in_args.size() < 3) {
         std::cout << USAGE << '\n';
@@ -82,6 +86,15 @@ bool parse_command_line_args(std::span<const char*> in_args, CodeGenArgs& out_pa
         return false;
     }
 
+    for (size_t i = 3; i < in_args.size(); ++i) {
+        if (std::string_view{ in_args[i] } == "--stable-ids") {
+            out_parsed_args.emit_stable_ids = true;
+        } else {
+            std::cout << "ERROR: unknown argument: '" << in_args[i] << "'.\n" << USAGE << '\n';
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -94,7 +107,7 @@ int main(int argc, const char* argv[])
         return 1;
     }
 
-    if (!convert_ifc_file(code_gen_args.input_ifc_path, code_gen_args.output_cpp_path))
+    if (!convert_ifc_file(code_gen_args.input_ifc_path, code_gen_args.output_cpp_path, code_gen_args.emit_stable_ids))
     {
         return 1;
     }